@@ -0,0 +1,5 @@
+#define VERSION "1.9.4"
+#define IDENTIFIER "d540c1314392d4ee9f646af505836f869d0c4c24"
+#define COMPILER "g++ (Debian 12.2.0-14+deb12u1) 12.2.0"
+#define FLAGS "-Wall -Wextra -g -DLOGGING"
+#define DATE "Sun Oct 18 17:09:16 UTC 2026 Linux vm 6.18.44-fc-v139 x86_64"
@@ -668,6 +668,10 @@ inline int Internal::determine_actual_backtrack_level (int jump) {
 
 void Internal::eagerly_subsume_recently_learned_clauses (Clause *c) {
   assert (opts.eagersubsume);
+  if (opts.eagersubsumeidx) {
+    eagerly_subsume_indexed_learned_clauses (c);
+    return;
+  }
   LOG (c, "trying eager subsumption with");
   mark (c);
   int64_t lim = stats.eagertried + opts.eagersubsumelim;
@@ -706,6 +710,88 @@ void Internal::eagerly_subsume_recently_learned_clauses (Clause *c) {
 #endif
 }
 
+// Same as above but over a much larger window of recently learned clauses
+// using the signature index 'eager' (see 'eager.hpp').  Only the smallest
+// bucket of the literals of the learned clause is traversed and candidates
+// are only checked if their signature contains the one of the clause.
+
+void Internal::eagerly_subsume_indexed_learned_clauses (Clause *c) {
+  LOG (c, "trying indexed eager subsumption with");
+  const size_t window = opts.eagersubsumewin;
+  if (eager.clauses.size () != window)
+    eager.init (window);
+  uint64_t signature = 0;
+  vector<uint64_t> *smallest = 0;
+  for (const auto &lit : *c) {
+    signature |= EagerIndex::signature (lit);
+    vector<uint64_t> &bucket = eager.buckets[EagerIndex::hash (lit)];
+    if (!smallest || bucket.size () < smallest->size ())
+      smallest = &bucket;
+  }
+  assert (smallest);
+#ifdef LOGGING
+  int64_t before = stats.eagersub;
+#endif
+  mark (c);
+  const uint64_t lower = eager.lower ();
+  const auto end = smallest->end ();
+  auto j = smallest->begin ();
+  for (auto i = j; i != end; i++) {
+    const uint64_t pos = *i;
+    if (pos < lower)
+      continue;
+    *j++ = pos;
+    const size_t slot = pos % window;
+    if (signature & ~eager.signatures[slot])
+      continue;
+    Clause *d = eager.clauses[slot];
+    stats.eagertried++;
+    if (d->garbage)
+      continue;
+    if (!d->redundant)
+      continue;
+    if (d->size < c->size)
+      continue;
+    int needed = c->size;
+    for (auto &lit : *d) {
+      if (marked (lit) <= 0)
+        continue;
+      if (!--needed)
+        break;
+    }
+    if (needed)
+      continue;
+    LOG (d, "eager subsumed");
+    stats.eagersub++;
+    stats.subsumed++;
+    mark_garbage (d);
+  }
+  smallest->resize (j - smallest->begin ());
+  unmark (c);
+#ifdef LOGGING
+  uint64_t subsumed = stats.eagersub - before;
+  if (subsumed)
+    LOG ("eagerly subsumed %" PRIu64 " clauses", subsumed);
+#endif
+
+  // Finally add the learned clause to the index.
+  //
+  const uint64_t pos = eager.added++;
+  const size_t slot = pos % window;
+  eager.clauses[slot] = c;
+  eager.signatures[slot] = signature;
+  for (const auto &lit : *c) {
+    vector<uint64_t> &bucket = eager.buckets[EagerIndex::hash (lit)];
+    if (!bucket.empty () && bucket.back () == pos)
+      continue;
+    if (bucket.size () >= 2 * window) {
+      const auto begin = bucket.begin ();
+      bucket.erase (begin, lower_bound (begin, bucket.end (), lower));
+    }
+    bucket.push_back (pos);
+  }
+}
+
 /*------------------------------------------------------------------------*/
 
 Clause *Internal::on_the_fly_strengthen (Clause *new_conflict, int uip) {
@@ -79,6 +79,11 @@ public:
     return from.start <= c && c < from.top;
   }
 
+  // Start and used size of 'from' space (needed for cloning).
+  //
+  const char *start () const { return from.start; }
+  size_t size () const { return from.top - from.start; }
+
   // Allocate that amount of memory in 'to' space.  This assumes the 'to'
   // space has been prepared to hold enough memory with 'prepare'.  Then
   // copy the memory pointed to by 'p' of size 'bytes'.  Note that it does
@@ -82,7 +82,9 @@ void Internal::elim_backward_clause (Eliminator &eliminator, Clause *c) {
         continue;
       int negated = 0;
       unsigned found = 0;
-      for (const auto &lit : *d) {
+      const const_literal_iterator end = d->end ();
+      for (const_literal_iterator l = d->begin (); l != end; l++) {
+        const int lit = *l;
         signed char tmp = val (lit);
         if (tmp > 0) {
           satisfied = true;
@@ -91,8 +93,14 @@ void Internal::elim_backward_clause (Eliminator &eliminator, Clause *c) {
         if (tmp < 0)
           continue;
         tmp = marked (lit);
-        if (!tmp)
+        if (!tmp) {
+          // Abort as soon as the remaining literals of 'd' can not
+          // contain all the remaining marked literals of 'c'.
+          //
+          if (found + (end - l - 1) < size)
+            break;
           continue;
+        }
         if (tmp < 0) {
           if (negated) {
             size = UINT_MAX;
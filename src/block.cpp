@@ -11,6 +11,11 @@ namespace CaDiCaL {
 // irredundant clause in negated form before and has not been tried to use
 // as blocking literal since then.
 
+// Literals are processed one at a time and not concurrently.  Blocking
+// uses the global mark table, moves literals to the front of clauses and
+// pushes blocked clauses on the extension stack, whose order has to be
+// deterministic for reconstruction, while the library is single threaded.
+
 /*------------------------------------------------------------------------*/
 
 inline bool block_more_occs_size::operator() (unsigned a, unsigned b) {
@@ -147,7 +152,8 @@ bool Internal::is_blocked_clause (Clause *c, int lit) {
 /*------------------------------------------------------------------------*/
 
 void Internal::block_schedule (Blocker &blocker) {
-  // Set skip flags for all literals in too large clauses.
+  // Count all literal occurrences in irredundant clauses and set skip
+  // flags for all literals in too large clauses.
   //
   for (const auto &c : clauses) {
 
@@ -155,6 +161,10 @@ void Internal::block_schedule (Blocker &blocker) {
       continue;
     if (c->redundant)
       continue;
+
+    for (const auto &lit : *c)
+      noccs (lit)++;
+
     if (c->size <= opts.blockmaxclslim)
       continue;
 
@@ -164,6 +174,7 @@ void Internal::block_schedule (Blocker &blocker) {
 
   // Connect all literal occurrences in irredundant clauses.
   //
+  reserve_occs ();
   for (const auto &c : clauses) {
 
     if (c->garbage)
@@ -184,13 +195,10 @@ void Internal::block_schedule (Blocker &blocker) {
   // is expensive to remove references to garbage clauses from 'occs' during
   // blocked clause elimination, but decrementing 'noccs' is cheap.
 
-  for (auto lit : lits) {
-    if (!active (lit))
-      continue;
-    assert (!val (lit));
-    Occs &os = occs (lit);
-    noccs (lit) = os.size ();
-  }
+#ifndef NDEBUG
+  for (auto lit : lits)
+    assert (noccs (lit) == (int64_t) occs (lit).size ());
+#endif
 
   // Now we fill the schedule (priority queue) of candidate literals to be
   // tried as blocking literals.  It is probably slightly faster to do this
@@ -745,6 +753,16 @@ bool Internal::block () {
   if (terminated_asynchronously ())
     return false;
 
+  // Literals are unmarked as soon they are tried.  If no literal has been
+  // marked since the last completed round, nothing can be scheduled.
+  // Frozen literals and those in too large clauses keep their mark but are
+  // also not scheduled (until a new mark occurs).
+  //
+  if (last.block.marked == stats.mark.block) {
+    LOG ("no new blocking literal candidates since last round");
+    return false;
+  }
+
   if (propagated < trail.size ()) {
     LOG ("need to propagate %zd units first", trail.size () - propagated);
     init_watches ();
@@ -790,6 +808,9 @@ bool Internal::block () {
     block_reschedule (blocker, lit);
   }
 
+  if (blocker.schedule.empty ())
+    last.block.marked = stats.mark.block;
+
   blocker.erase ();
   reset_noccs ();
   reset_occs ();
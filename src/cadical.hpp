@@ -500,6 +500,21 @@ public:
   //
   void copy (Solver &other) const;
 
+  // Clone the complete state of 'this' into a fresh 'other', including
+  // learned clauses, watches, the trail, scores, phases, options,
+  // statistics and the extension stack.  Both solvers are completely
+  // independent afterwards but 'other' continues exactly where 'this'
+  // would continue.  Clauses are copied in bulk into the arena of 'other'.
+  // Proof tracing and external propagators are not supported.
+  //
+  //   require (READY)          // for 'this'
+  //   ensure (READY)           // for 'this'
+  //
+  //   other.require (CONFIGURING)
+  //   other.ensure (READY)     // same state as 'this'
+  //
+  void clone (Solver &other);
+
   /*----------------------------------------------------------------------*/
   // Variables are usually added and initialized implicitly whenever a
   // literal is used as an argument except for the functions 'val', 'fixed',
@@ -521,6 +536,17 @@ public:
   //
   void reserve (int min_max_var);
 
+  // Release memory which is kept at its historical peak capacity, i.e.,
+  // scratch vectors and occurrence tables used during preprocessing and
+  // inprocessing, watch lists with large slack as well as garbage in the
+  // clause arena.  This is meant for long-lived solver instances between
+  // incremental calls and does not change the state of the solver.
+  //
+  //   require (VALID)
+  //   ensure (VALID)
+  //
+  void release_memory ();
+
 #ifndef NTRACING
   //------------------------------------------------------------------------
   // This function can be used to write API calls to a file.  The same
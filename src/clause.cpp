@@ -100,6 +100,7 @@ Clause *Internal::new_clause (bool red, int glue) {
   c->conditioned = false;
   c->covered = false;
   c->enqueued = false;
+  c->flushed = false;
   c->frozen = false;
   c->garbage = false;
   c->gate = false;
@@ -142,6 +143,9 @@ Clause *Internal::new_clause (bool red, int glue) {
   clauses.push_back (c);
   LOG (c, "new pointer %p", (void *) c);
 
+  if (!red && size > 2 && opts.deduplicate)
+    duplicates.added.push_back (c);
+
   if (likely_to_be_kept_clause (c))
     mark_added (c);
 
@@ -252,7 +256,7 @@ void Internal::delete_clause (Clause *c) {
     // from the proof perspective is that the deletion of these binary
     // clauses occurs later in the proof file.
     //
-    if (proof && c->size == 2) {
+    if (proof && c->size == 2 && !c->flushed) {
       proof->delete_clause (c);
     }
   }
@@ -306,6 +310,11 @@ void Internal::mark_garbage (Clause *c) {
   c->garbage = true;
   c->used = 0;
 
+  // Remember garbage binary clauses for 'remove_garbage_binaries'.
+  //
+  if (c->size == 2)
+    pending.push_back (c);
+
   LOG (c, "marked garbage pointer %p", (void *) c);
 }
 
@@ -27,6 +27,7 @@ struct Clause {
   bool conditioned : 1; // Tried for globally blocked clause elimination.
   bool covered : 1;  // Already considered for covered clause elimination.
   bool enqueued : 1; // Enqueued on backward queue.
+  bool flushed : 1;  // Garbage binary already unwatched and traced deleted.
   bool frozen : 1;   // Temporarily frozen (in covered clause elimination).
   bool garbage : 1;  // can be garbage collected unless it is a 'reason'
   bool gate : 1;     // Clause part of a gate (function definition).
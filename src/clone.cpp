@@ -0,0 +1,248 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// In contrast to 'Solver::copy', which only copies irredundant clauses
+// through 'traverse_clauses' and thus loses learned clauses, scores and
+// phases, cloning duplicates the complete internal and external state of
+// a solver into a fresh one.  Most of the state consists of plain tables
+// which are just copied.  The only non-trivial part are clauses, since
+// watches, reasons and the 'clauses' stack refer to them by pointer.
+
+// Clauses are copied into the arena of the clone.  All clauses in the
+// arena of 'this' are copied with a single 'memcpy' and pointers to them
+// are rebased by the distance between the old and the new arena.  The
+// remaining clauses allocated outside of the arena (after the last moving
+// garbage collection) are copied one by one and also kept outside of the
+// arena, since the next garbage collection treats them differently (see
+// 'opts.arenacompact').  Their pointers are mapped by binary search over
+// their sorted addresses.
+
+/*------------------------------------------------------------------------*/
+
+struct Rebaser {
+
+  const Arena &arena;   // of the original solver
+  const char *from;     // start of original arena
+  char *to;             // start of cloned arena
+  vector<Clause *> src; // clauses outside of original arena (sorted)
+  vector<Clause *> dst; // their copies in the cloned arena
+
+  Rebaser (const Arena &a) : arena (a), from (0), to (0) {}
+
+  Clause *operator() (Clause *c) const {
+    if (!c)
+      return 0;
+    if (arena.contains (c))
+      return (Clause *) (to + ((char *) c - from));
+    const auto end = src.end ();
+    const auto i = lower_bound (src.begin (), end, c);
+    assert (i != end && *i == c);
+    return dst[i - src.begin ()];
+  }
+};
+
+void Internal::clone_clauses (Internal &other) const {
+
+  assert (other.clauses.empty ());
+
+  Rebaser rebase (arena);
+  const size_t bytes = arena.size ();
+  for (const auto &c : clauses)
+    if (!arena.contains (c))
+      rebase.src.push_back (c);
+  sort (rebase.src.begin (), rebase.src.end ());
+
+  rebase.from = arena.start ();
+  if (bytes) {
+    Arena &dst = other.arena;
+    dst.prepare (bytes);
+    rebase.to = dst.copy (rebase.from, bytes);
+    dst.swap ();
+  }
+  for (const auto &c : rebase.src) {
+    const size_t size = c->bytes ();
+    char *p = new char[size];
+    memcpy (p, (char *) c, size);
+    rebase.dst.push_back ((Clause *) p);
+  }
+
+  LOG ("cloned %zd clauses with arena of %zd bytes (%zd outside)",
+       clauses.size (), bytes, rebase.src.size ());
+
+  other.clauses.reserve (clauses.size ());
+  for (const auto &c : clauses)
+    other.clauses.push_back (rebase (c));
+
+  other.wtab = wtab;
+  for (auto &ws : other.wtab)
+    for (auto &w : ws)
+      w.clause = rebase (w.clause);
+
+  // Reasons of unassigned variables are stale and root level units do not
+  // have a reason (see 'search_assign').
+  //
+  other.vtab = vtab;
+  for (auto idx : vars) {
+    Var &v = other.vtab[idx];
+    if (val (idx) && v.level)
+      v.reason = rebase (v.reason);
+    else
+      v.reason = 0;
+  }
+
+  other.pending.reserve (pending.size ());
+  for (const auto &c : pending)
+    other.pending.push_back (rebase (c));
+
+  other.duplicates = duplicates;
+  for (auto &c : other.duplicates.added)
+    c = rebase (c);
+  for (auto &e : other.duplicates.table)
+    e.clause = rebase (e.clause);
+
+  // Only slots in the window of the eager subsumption index point to
+  // clauses still on the 'clauses' stack (see 'eager.hpp').
+  //
+  other.eager = eager;
+  vector<Clause *> &ring = other.eager.clauses;
+  const size_t window = ring.size ();
+  for (auto &c : ring)
+    c = 0;
+  for (uint64_t pos = eager.lower (); pos < eager.added; pos++) {
+    const size_t slot = pos % window;
+    ring[slot] = rebase (eager.clauses[slot]);
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+void Internal::clone (Internal &other) {
+
+  assert (!level || !external_prop);
+  assert (!proof && !other.proof);
+  assert (!conflict || unsat);
+  assert (!occurring ());
+  assert (!other.max_var);
+
+  START (clone);
+
+  opts.copy (other.opts);
+
+  other.mode = mode;
+  other.unsat = unsat;
+  other.stable = stable;
+  other.rephased = rephased;
+  other.reluctant = reluctant;
+  other.max_var = max_var;
+  other.fixed_anchor = fixed_anchor;
+  other.clause_id = clause_id;
+  other.original_id = original_id;
+  other.reserved_ids = reserved_ids;
+  other.conflict_id = conflict_id;
+  other.concluded = concluded;
+  other.conclusion = conclusion;
+  other.unit_clauses = unit_clauses;
+  other.level = level;
+  other.phases = phases;
+
+  if (other.vals) {
+    other.vals -= other.vsize;
+    delete[] other.vals;
+    other.vals = 0;
+  }
+  if (vsize) {
+    other.vals = new signed char[2 * vsize];
+    memcpy (other.vals, vals - vsize, 2 * vsize);
+    other.vals += vsize;
+  }
+  other.vsize = vsize;
+
+  other.marks = marks;
+  other.frozentab = frozentab;
+  other.i2e = i2e;
+  other.relevanttab = relevanttab;
+  other.queue = queue;
+  other.links = links;
+  other.score_inc = score_inc;
+  other.stab = stab;
+  other.parents = parents;
+  other.ftab = ftab;
+  other.btab = btab;
+  other.gtab = gtab;
+  other.ptab = ptab;
+  other.ntab = ntab;
+
+  // The score heap uses 'this' in its comparison object.  Pushing the
+  // elements in heap order reproduces exactly the same heap.
+  //
+  other.scores.clear ();
+  for (const auto &idx : scores)
+    other.scores.push_back (idx);
+
+  clone_clauses (other);
+
+  other.notified = notified;
+  other.propagated = propagated;
+  other.propagated2 = propagated2;
+  other.propergated = propergated;
+  other.best_assigned = best_assigned;
+  other.target_assigned = target_assigned;
+  other.no_conflict_until = no_conflict_until;
+  other.trail = trail;
+  other.assumptions = assumptions;
+  other.constraint = constraint;
+  other.unsat_constraint = unsat_constraint;
+  other.marked_failed = marked_failed;
+  other.num_assigned = num_assigned;
+  other.gatetab = gatetab;
+  other.probes = probes;
+  other.retired = retired;
+  other.reusable = reusable;
+  other.control = control;
+  other.averages = averages;
+  other.lim = lim;
+  other.last = last;
+  other.inc = inc;
+
+  other.stats = stats;
+  other.stats.internal = &other;
+
+  stats.clones++;
+  STOP (clone);
+
+  PHASE ("clone", stats.clones,
+         "cloned %d variables and %zd clauses", max_var, clauses.size ());
+}
+
+/*------------------------------------------------------------------------*/
+
+void External::clone (External &other) {
+
+  assert (!propagator);
+  assert (!other.max_var);
+
+  internal->clone (*other.internal);
+
+  other.max_var = max_var;
+  other.vsize = vsize;
+  other.vals = vals;
+  other.e2i = e2i;
+  other.assumptions = assumptions;
+  other.constraint = constraint;
+  other.ext_units = ext_units;
+  other.ext_flags = ext_flags;
+  other.extended = extended;
+  other.concluded = concluded;
+  other.extension = extension;
+  other.witness = witness;
+  other.tainted = tainted;
+  other.frozentab = frozentab;
+  other.is_observed = is_observed;
+  other.original = original;
+  other.moltentab = moltentab;
+}
+
+} // namespace CaDiCaL
@@ -270,6 +270,9 @@ void Internal::update_reason_references () {
 void Internal::delete_garbage_clauses () {
 
   flush_all_occs_and_watches ();
+  update_duplicated_clause_references ();
+  eager.clear ();
+  pending.clear ();
 
   LOG ("deleting garbage clauses");
 #ifndef QUIET
@@ -318,6 +321,9 @@ void Internal::copy_clause (Clause *c) {
 
 void Internal::copy_non_garbage_clauses () {
 
+  eager.clear ();
+  pending.clear ();
+
   size_t collected_clauses = 0, collected_bytes = 0;
   size_t moved_clauses = 0, moved_bytes = 0;
 
@@ -377,6 +383,32 @@ void Internal::copy_non_garbage_clauses () {
           if (!w.clause->moved && !w.clause->collect ())
             copy_clause (w.clause);
 
+  } else if (opts.arenatype == 4) {
+
+    // Localize according to propagation order on the trail.
+
+    // Propagating an assigned literal visits the watches of its negation.
+    // Thus copying the clauses watched by the negations of the literals on
+    // the trail in trail order puts clauses next to each other which are
+    // visited together if the same literals are propagated again after
+    // backtracking.  Root level literals are skipped, since their watched
+    // clauses are either satisfied or never visited again.  All remaining
+    // watched clauses follow in decision queue order as for the default.
+
+    for (const auto &lit : trail) {
+      if (!var (lit).level)
+        continue;
+      for (const auto &w : watches (-lit))
+        if (!w.clause->moved && !w.clause->collect ())
+          copy_clause (w.clause);
+    }
+
+    for (int sign = -1; sign <= 1; sign += 2)
+      for (int idx = queue.last; idx; idx = link (idx).prev)
+        for (const auto &w : watches (sign * likely_phase (idx)))
+          if (!w.clause->moved && !w.clause->collect ())
+            copy_clause (w.clause);
+
   } else {
 
     // Localize according to decision queue order.
@@ -403,6 +435,7 @@ void Internal::copy_non_garbage_clauses () {
 
   flush_all_occs_and_watches ();
   update_reason_references ();
+  update_duplicated_clause_references ();
 
   // Replace and flush clause references in 'clauses'.
   //
@@ -463,8 +496,15 @@ void Internal::check_clause_stats () {
 
 /*------------------------------------------------------------------------*/
 
-// only delete binary clauses from watch list that are already mark as
-// deleted.
+// Only delete binary clauses from watch list that are already marked as
+// deleted.  Binary clauses marked as garbage since the last garbage
+// collection are remembered as 'pending' in 'mark_garbage'.  Instead of
+// sweeping all watch lists we only flush the watch lists of their literals
+// and trace their deletion, which for binary clauses is otherwise delayed
+// until they are actually deleted (see 'delete_clause').  They are marked
+// as 'flushed' and then deallocated during the next garbage collection.
+// Thus neither all watches nor all clauses are traversed here.
+
 void Internal::remove_garbage_binaries () {
   if (unsat)
     return;
@@ -473,44 +513,67 @@ void Internal::remove_garbage_binaries () {
   if (!protected_reasons)
     protect_reasons ();
   int backtrack_level = level + 1;
+
+  vector<int> lits;
+  for (const auto &c : pending) {
+    assert (c->garbage);
+    assert (c->size == 2);
+    for (const auto &lit : *c) {
+      if (marked2 (lit))
+        continue;
+      mark2 (lit);
+      lits.push_back (lit);
+    }
+  }
+  LOG ("flushing watches of %zd pending literals", lits.size ());
+
   Watches saved;
-  for (auto v : vars) {
-    for (auto lit : {-v, v}) {
-      assert (saved.empty ());
-      Watches &ws = watches (lit);
-      const const_watch_iterator end = ws.end ();
-      watch_iterator j = ws.begin ();
-      const_watch_iterator i;
-      for (i = j; i != end; i++) {
-        Watch w = *i;
-        Clause *c = w.clause;
-        if (c->reason && c->collect ()) {
-          assert (c->size == 2);
-          backtrack_level =
-              min (backtrack_level, var (c->literals[0]).level);
-          LOG ("need to backtrack to before level %d", backtrack_level);
-        }
-        if (c->collect ())
-          continue;
-        assert (!c->moved);
-        w.size = c->size;
-        const int new_blit_pos = (c->literals[0] == lit);
-        LOG (c, "clause in flush_watch starting from %d", lit);
-        assert (c->literals[!new_blit_pos] == lit); /*FW1*/
-        w.blit = c->literals[new_blit_pos];
-        if (w.binary ())
-          *j++ = w;
-        else
-          saved.push_back (w);
+  for (const auto &lit : lits) {
+    unmark (lit);
+    stats.pending++;
+    assert (saved.empty ());
+    Watches &ws = watches (lit);
+    const const_watch_iterator end = ws.end ();
+    watch_iterator j = ws.begin ();
+    const_watch_iterator i;
+    for (i = j; i != end; i++) {
+      Watch w = *i;
+      Clause *c = w.clause;
+      if (c->reason && c->collect ()) {
+        assert (c->size == 2);
+        backtrack_level = min (backtrack_level, var (c->literals[0]).level);
+        LOG ("need to backtrack to before level %d", backtrack_level);
       }
-      ws.resize (j - ws.begin ());
-      for (const auto &w : saved)
-        ws.push_back (w);
-      saved.clear ();
-      shrink_vector (ws);
+      if (c->collect ())
+        continue;
+      assert (!c->moved);
+      w.size = c->size;
+      const int new_blit_pos = (c->literals[0] == lit);
+      LOG (c, "clause in flush_watch starting from %d", lit);
+      assert (c->literals[!new_blit_pos] == lit); /*FW1*/
+      w.blit = c->literals[new_blit_pos];
+      if (w.binary ())
+        *j++ = w;
+      else
+        saved.push_back (w);
     }
+    ws.resize (j - ws.begin ());
+    for (const auto &w : saved)
+      ws.push_back (w);
+    saved.clear ();
+    shrink_vector (ws);
   }
-  delete_garbage_clauses ();
+
+  for (const auto &c : pending) {
+    if (!c->collect ())
+      continue;
+    LOG (c, "flushed");
+    if (proof)
+      proof->delete_clause (c);
+    c->flushed = true;
+  }
+  erase_vector (pending);
+
   unprotect_reasons ();
   if (backtrack_level - 1 < level)
     backtrack (backtrack_level - 1);
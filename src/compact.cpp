@@ -19,6 +19,12 @@ bool Internal::compacting () {
     return false;
   int inactive = max_var - active ();
   assert (inactive >= 0);
+  if (opts.recycle) {
+    // Recycled variables are going to be reused and retired variables are
+    // recycled soon, so both do not count as holes which need compacting.
+    //
+    inactive -= min ((size_t) inactive, reusable.size () + retired.size ());
+  }
   if (!inactive)
     return false;
   if (inactive < opts.compactmin)
@@ -449,6 +455,16 @@ void Internal::compact () {
   if (!big.empty ())
     mapper.map2_vector (big);
 
+  // Literal hashes of cached gate clauses refer to the old literals, so
+  // they would not match anymore anyhow.
+  //
+  erase_vector (gatetab);
+
+  // The same applies to the hash values of the clauses in the persistent
+  // table for deduplication, which are thus recomputed.
+  //
+  rehash_duplicated_clauses ();
+
   /*======================================================================*/
   // In the fourth part we map the binary heap for scores.
   /*======================================================================*/
@@ -518,6 +534,13 @@ void Internal::compact () {
   max_var = mapper.new_max_var;
   vsize = mapper.new_vsize;
 
+  // Compacting removes all inactive variables except the first fixed one,
+  // which thus also becomes the anchor for recycling fixed variables.
+  //
+  erase_vector (retired);
+  erase_vector (reusable);
+  fixed_anchor = mapper.map_first_fixed;
+
   stats.unused = 0;
   stats.inactive = stats.now.fixed = mapper.first_fixed ? 1 : 0;
   stats.now.substituted = stats.now.eliminated = stats.now.pure = 0;
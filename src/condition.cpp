@@ -30,7 +30,12 @@ namespace CaDiCaL {
 // is to trigger 'condition' if the decision level is above the current
 // moving average of the back jump level.
 
-// TODO We might need to consider less frequent conditioning.
+// Each round has to go over all irredundant clauses to collect candidates
+// and to compute the initial conditional part, independently of how many
+// candidates are tried.  Instead of skipping conditioning completely if
+// there are many more clauses than variables, we account for this fixed
+// cost by delaying the next round proportionally to the clause variable
+// ratio exceeding 'conditionmaxrat' (see 'condition' below).
 
 bool Internal::conditioning () {
 
@@ -54,11 +59,7 @@ bool Internal::conditioning () {
 
   if (!stats.current.irredundant)
     return false;
-  double remain = active ();
-  if (!remain)
-    return false;
-  double ratio = stats.current.irredundant / remain;
-  return ratio <= opts.conditionmaxrat;
+  return active () > 0;
 }
 
 /*------------------------------------------------------------------------*/
@@ -417,6 +418,38 @@ long Internal::condition_round (long delta) {
   assert (initial.conditional == conditional.size ());
   assert (initial.assigned == initial.conditional + initial.autarky);
 
+  // Candidates without an autarky literal in the initial partition can
+  // not become globally blocked during refinement, since autarky literals
+  // are only turned into conditional literals.  Filtering them here avoids
+  // marking their literals and consuming their 'conditioned' bit.
+  //
+  {
+    const auto end = candidates.end ();
+    auto j = candidates.begin ();
+    for (auto i = j; i != end; i++) {
+      Clause *c = *j++ = *i;
+      bool autarky = false;
+      for (const auto &lit : *c)
+        if (is_autarky_literal (lit)) {
+          autarky = true;
+          break;
+        }
+      if (autarky)
+        continue;
+      if (c->conditioned)
+        conditioned--;
+      else
+        unconditioned--;
+      j--;
+    }
+    const size_t filtered = end - j;
+    stats.condfiltered += filtered;
+    candidates.resize (j - candidates.begin ());
+    PHASE ("condition", stats.conditionings,
+           "filtered %zd candidates without initial autarky literal",
+           filtered);
+  }
+
   stats.condassinit += initial.assigned;
   stats.condcondinit += initial.conditional;
   stats.condautinit += initial.autarky;
@@ -520,6 +553,12 @@ long Internal::condition_round (long delta) {
     //
     int watched_autarky_literal = 0;
 
+    // Autarky literals only turn into conditional literals while refining
+    // the assignment for this candidate.  Thus the search for a replacement
+    // of the watched autarky literal can resume after its position.
+    //
+    const_literal_iterator autarky_position = c->end ();
+
     // First mark all true literals in the candidate clause and find an
     // autarky literal which witnesses that this clause has still a chance
     // to be globally blocked.
@@ -532,6 +571,7 @@ long Internal::condition_round (long delta) {
       if (!is_autarky_literal (lit))
         continue;
       watched_autarky_literal = lit;
+      autarky_position = l;
 
       // TODO assign non-assigned literals to false?
       // Which might need to trigger watching additional clauses.
@@ -618,13 +658,13 @@ long Internal::condition_round (long delta) {
           int replacement = 0; // New watched literal in 'd'.
           int negative = 0;    // Negative autarky literals in 'd'.
 
-          for (const_literal_iterator l = d->begin (); l != d->end ();
-               l++) {
+          for (const_literal_iterator l = d->begin ();
+               !replacement && l != d->end (); l++) {
             const int lit = *l;
             const signed char tmp = val (lit);
             if (tmp > 0)
               replacement = lit;
-            if (tmp < 0 && is_autarky_literal (-lit))
+            else if (tmp < 0 && is_autarky_literal (-lit))
               negative++;
           }
 
@@ -670,15 +710,13 @@ long Internal::condition_round (long delta) {
             LOG ("need to replace autarky literal %d in candidate", -lit);
             replacement = 0;
 
-            // TODO save starting point because we only move it forward?
-
-            for (const_literal_iterator k = c->begin ();
-                 !replacement && k != c->end (); k++) {
-              const int other = *k;
+            assert (autarky_position != c->end ());
+            assert (*autarky_position == watched_autarky_literal);
+            while (!replacement && ++autarky_position != c->end ()) {
+              const int other = *autarky_position;
               if (is_autarky_literal (other))
                 replacement = other;
             }
-            watched_autarky_literal = replacement;
 
             if (replacement) {
               LOG (c, "watching autarky %d instead %d in candidate",
@@ -929,6 +967,14 @@ void Internal::condition (bool update_limits) {
     return;
 
   long delta = opts.conditionint * (stats.conditionings + 1);
+  const double remain = active ();
+  if (remain) {
+    const double ratio = stats.current.irredundant / remain;
+    if (ratio > opts.conditionmaxrat) {
+      delta *= ratio / opts.conditionmaxrat;
+      stats.conddelayed++;
+    }
+  }
   lim.condition = stats.conflicts + delta;
 
   PHASE ("condition", stats.conditionings,
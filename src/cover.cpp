@@ -21,12 +21,24 @@ namespace CaDiCaL {
 // found during ALA steps or if during a CLA step all resolution candidates
 // of a literal on the trail are satisfied (the extended clause is blocked).
 
+// Consecutive candidate clauses often share literals and then most of the
+// ALA steps are repeated.  With 'coverprefix' the literals of candidates
+// are sorted and candidates of the same size lexicographically, such that
+// the ALA assignment of the longest shared prefix can be kept instead of
+// recomputed (the same idea as reusing decisions during vivification).
+// This is sound as long as the kept assignment does not depend on the
+// candidate clause itself, which is checked through the recorded reasons.
+
 struct Coveror {
   std::vector<int> added;        // acts as trail
   std::vector<int> extend;       // extension stack for witness
   std::vector<int> covered;      // clause literals or added through CLA
   std::vector<int> intersection; // of literals in resolution candidates
 
+  std::vector<Clause *> reasons; // of 'added' literals (zero if assumed)
+  std::vector<int> prefix;       // kept assumed candidate literals
+  std::vector<size_t> trail;     // size of 'added' after each of those
+
   size_t alas, clas; // actual number of ALAs and CLAs
 
   struct {
@@ -71,6 +83,7 @@ inline void Internal::covered_literal_addition (int lit, Coveror &coveror) {
     set_val (other, -1);
     coveror.covered.push_back (other);
     coveror.added.push_back (other);
+    coveror.reasons.push_back (0);
     coveror.clas++;
   }
   coveror.next.covered = 0;
@@ -78,7 +91,7 @@ inline void Internal::covered_literal_addition (int lit, Coveror &coveror) {
 
 // Successful asymmetric literal addition (ALA) step.
 
-inline void Internal::asymmetric_literal_addition (int lit,
+inline void Internal::asymmetric_literal_addition (int lit, Clause *reason,
                                                    Coveror &coveror) {
   require_mode (COVER);
   assert (level == 1);
@@ -86,6 +99,7 @@ inline void Internal::asymmetric_literal_addition (int lit,
   assert (!vals[lit]), assert (!vals[-lit]);
   set_val (lit, -1);
   coveror.added.push_back (lit);
+  coveror.reasons.push_back (reason);
   coveror.alas++;
   coveror.next.covered = 0;
 }
@@ -122,7 +136,7 @@ bool Internal::cover_propagate_asymmetric (int lit, Clause *ignore,
         LOG (w.clause, "found subsuming");
         subsumed = true;
       } else
-        asymmetric_literal_addition (-w.blit, coveror);
+        asymmetric_literal_addition (-w.blit, w.clause, coveror);
     } else {
       literal_iterator lits = w.clause->begin ();
       const int other = lits[0] ^ lits[1] ^ lit;
@@ -157,7 +171,7 @@ bool Internal::cover_propagate_asymmetric (int lit, Clause *ignore,
           j--;
         } else if (!u) {
           assert (v < 0);
-          asymmetric_literal_addition (-other, coveror);
+          asymmetric_literal_addition (-other, w.clause, coveror);
         } else {
           assert (u < 0), assert (v < 0);
           LOG (w.clause, "found subsuming");
@@ -320,40 +334,136 @@ bool Internal::cover_propagate_covered (int lit, Coveror &coveror) {
 
 /*------------------------------------------------------------------------*/
 
-bool Internal::cover_clause (Clause *c, Coveror &coveror) {
+// Unassign the literals added after the first 'size' ones.
+
+inline void Internal::cover_backtrack (size_t size, Coveror &coveror) {
+  assert (size <= coveror.added.size ());
+  assert (coveror.reasons.size () == coveror.added.size ());
+  while (coveror.added.size () > size) {
+    set_val (coveror.added.back (), 0);
+    coveror.added.pop_back ();
+  }
+  coveror.reasons.resize (size);
+}
+
+// Assume the sorted (zero terminated) literals of the candidate clause one
+// after the other and propagate each of them to completion.  The prefix of
+// literals shared with the previous candidate is kept, except for the part
+// of it in which the candidate itself or an already eliminated clause was
+// used as reason, since neither of them is part of the formula anymore.
+// Returns 'true' if the candidate is an asymmetric tautology.
+
+bool Internal::cover_assume_prefix (Clause *c, const int *lits,
+                                    Coveror &coveror) {
+  const size_t size = coveror.prefix.size ();
+  size_t shared = 0;
+  while (shared < size && lits[shared] == coveror.prefix[shared])
+    shared++;
+
+  if (shared) {
+    const size_t end = coveror.trail[shared - 1];
+    size_t pos = 0;
+    while (pos < end) {
+      Clause *reason = coveror.reasons[pos];
+      if (reason == c || (reason && reason->garbage))
+        break;
+      pos++;
+    }
+    while (shared && coveror.trail[shared - 1] > pos)
+      shared--;
+  }
+
+  const size_t kept = shared ? coveror.trail[shared - 1] : 0;
+  LOG ("keeping %zd assumed literals and %zd added literals", shared,
+       kept);
+  cover_backtrack (kept, coveror);
+  coveror.prefix.resize (shared);
+  coveror.trail.resize (shared);
+  coveror.next.added = kept;
+  stats.cover.reused += kept;
+
+  level = 1;
+  bool tautological = false;
+  for (const int *p = lits + shared; !tautological && *p; p++) {
+    const int lit = *p;
+    const signed char tmp = val (lit);
+    if (tmp > 0) {
+      LOG ("literal %d implied by assumed prefix", lit);
+      tautological = true;
+    } else {
+      if (!tmp)
+        asymmetric_literal_addition (lit, 0, coveror);
+      while (!tautological && coveror.next.added < coveror.added.size ()) {
+        const int other = coveror.added[coveror.next.added++];
+        tautological = cover_propagate_asymmetric (other, c, coveror);
+      }
+      if (!tautological) {
+        coveror.prefix.push_back (lit);
+        coveror.trail.push_back (coveror.added.size ());
+      }
+    }
+  }
+
+  // The candidate literals are copied to 'covered' in clause order, which
+  // is assumed when adding the literals not needed for covering below.
+
+  for (const int *p = lits; *p; p++)
+    mark (*p);
+  for (const auto &lit : *c)
+    if (marked (lit)) {
+      coveror.covered.push_back (lit);
+      unmark (lit);
+    }
+
+  return tautological;
+}
+
+bool Internal::cover_clause (Clause *c, const int *lits, Coveror &coveror) {
 
   require_mode (COVER);
   assert (!c->garbage);
 
   LOG (c, "trying covered clauses elimination on");
-  bool satisfied = false;
-  for (const auto &lit : *c)
-    if (val (lit) > 0)
-      satisfied = true;
 
-  if (satisfied) {
-    LOG (c, "clause already satisfied");
-    mark_garbage (c);
-    return false;
+  // With a kept prefix assignment the values are not root level values.
+  // Candidates are not root-level satisfied anyhow in that case.
+  //
+  if (!level) {
+    bool satisfied = false;
+    for (const auto &lit : *c)
+      if (val (lit) > 0)
+        satisfied = true;
+
+    if (satisfied) {
+      LOG (c, "clause already satisfied");
+      mark_garbage (c);
+      return false;
+    }
   }
 
-  assert (coveror.added.empty ());
   assert (coveror.extend.empty ());
   assert (coveror.covered.empty ());
 
-  assert (!level);
-  level = 1;
-  LOG ("assuming literals of candidate clause");
-  for (const auto &lit : *c) {
-    if (val (lit))
-      continue;
-    asymmetric_literal_addition (lit, coveror);
-    coveror.covered.push_back (lit);
-  }
-
   bool tautological = false;
 
-  coveror.next.added = coveror.next.covered = 0;
+  if (lits) {
+    LOG ("assuming sorted literals of candidate clause");
+    tautological = cover_assume_prefix (c, lits, coveror);
+  } else {
+    assert (coveror.added.empty ());
+    assert (!level);
+    level = 1;
+    LOG ("assuming literals of candidate clause");
+    for (const auto &lit : *c) {
+      if (val (lit))
+        continue;
+      asymmetric_literal_addition (lit, 0, coveror);
+      coveror.covered.push_back (lit);
+    }
+    coveror.next.added = 0;
+  }
+
+  coveror.next.covered = 0;
 
   while (!tautological) {
     if (coveror.next.added < coveror.added.size ()) {
@@ -448,16 +558,17 @@ bool Internal::cover_clause (Clause *c, Coveror &coveror) {
     }
   }
 
-  // Backtrack and 'unassign' all literals.
+  // Backtrack and 'unassign' all literals except for the kept prefix.
 
   assert (level == 1);
-  for (const auto &lit : coveror.added)
-    set_val (lit, 0);
-  level = 0;
+  if (coveror.prefix.empty ()) {
+    cover_backtrack (0, coveror);
+    level = 0;
+  } else
+    cover_backtrack (coveror.trail.back (), coveror);
 
   coveror.covered.clear ();
   coveror.extend.clear ();
-  coveror.added.clear ();
 
   return tautological;
 }
@@ -476,6 +587,47 @@ struct clause_covered_or_smaller {
   }
 };
 
+// Order of literals within and of candidates with the same size across
+// sorted candidate clauses for sharing assumed prefixes.
+
+struct cover_literal_rank {
+  Internal *internal;
+  cover_literal_rank (Internal *i) : internal (i) {}
+  bool operator() (int a, int b) const {
+    const size_t s = internal->occs (a).size ();
+    const size_t t = internal->occs (b).size ();
+    if (s > t)
+      return true;
+    if (s < t)
+      return false;
+    return a < b;
+  }
+};
+
+struct cover_candidate {
+  Clause *clause;
+  size_t offset; // of the sorted literals in 'sorted'
+  size_t size;   // number of sorted literals
+};
+
+struct cover_candidate_smaller {
+  const int *sorted;
+  cover_literal_rank rank;
+  cover_candidate_smaller (const int *s, const cover_literal_rank &r)
+      : sorted (s), rank (r) {}
+  bool operator() (const cover_candidate &a, const cover_candidate &b) {
+    const Clause *c = a.clause, *d = b.clause;
+    if (c->covered && !d->covered)
+      return true;
+    if (!c->covered && d->covered)
+      return false;
+    if (c->size != d->size)
+      return c->size < d->size;
+    const int *p = sorted + a.offset, *q = sorted + b.offset;
+    return lexicographical_compare (p, p + a.size, q, q + b.size, rank);
+  }
+};
+
 int64_t Internal::cover_round () {
 
   if (unsat)
@@ -589,6 +741,37 @@ int64_t Internal::cover_round () {
   stable_sort (schedule.begin (), schedule.end (),
                clause_covered_or_smaller ());
 
+  // For sharing assumed prefixes the literals of candidates are sorted by
+  // decreasing number of occurrences and candidates of the same size
+  // lexicographically with respect to that order.
+  //
+  vector<int> sorted;
+  vector<size_t> offsets;
+  if (opts.coverprefix) {
+    const cover_literal_rank rank (this);
+    vector<cover_candidate> candidates;
+    candidates.reserve (schedule.size ());
+    for (const auto &c : schedule) {
+      cover_candidate candidate;
+      candidate.clause = c;
+      candidate.offset = sorted.size ();
+      for (const auto &lit : *c)
+        if (!val (lit))
+          sorted.push_back (lit);
+      candidate.size = sorted.size () - candidate.offset;
+      sort (sorted.begin () + candidate.offset, sorted.end (), rank);
+      sorted.push_back (0);
+      candidates.push_back (candidate);
+    }
+    stable_sort (candidates.begin (), candidates.end (),
+                 cover_candidate_smaller (sorted.data (), rank));
+    offsets.reserve (candidates.size ());
+    for (size_t i = 0; i < candidates.size (); i++) {
+      schedule[i] = candidates[i].clause;
+      offsets.push_back (candidates[i].offset);
+    }
+  }
+
 #ifndef QUIET
   const size_t scheduled = schedule.size ();
   PHASE ("cover", stats.cover.count,
@@ -616,11 +799,21 @@ int64_t Internal::cover_round () {
          stats.propagations.cover < limit) {
     Clause *c = schedule.back ();
     schedule.pop_back ();
+    const int *lits = 0;
+    if (opts.coverprefix) {
+      lits = sorted.data () + offsets.back ();
+      offsets.pop_back ();
+    }
     c->covered = true;
-    if (cover_clause (c, coveror))
+    if (cover_clause (c, lits, coveror))
       covered++;
   }
 
+  if (level) {
+    cover_backtrack (0, coveror);
+    level = 0;
+  }
+
 #ifndef QUIET
   const size_t remain = schedule.size ();
   const size_t tried = scheduled - remain;
@@ -150,7 +150,14 @@ void Internal::clear_decomposed_literals () {
 // repeat it since its application might produce new binary clauses or
 // units.  Such units might even result in an empty clause.
 
-bool Internal::decompose_round () {
+// Any SCC which did not exist in the previous round has to contain one of
+// the binary clauses produced by substitution in the previous round.  Thus
+// if 'roots' is given and not empty, the depth first searches only start
+// at the variables in 'roots', which are then replaced by the literals of
+// the binary clauses produced in this round.  Literals not reached from
+// those roots are their own representative.
+
+bool Internal::decompose_round (vector<int> *roots) {
 
   if (!opts.decompose)
     return false;
@@ -188,10 +195,28 @@ bool Internal::decompose_round () {
   vector<int> work; // depth first search working stack
   vector<int> scc;  // collects members of one SCC
 
+  vector<int> sources; // roots of incremental round
+  if (roots)
+    sources.swap (*roots);
+
+  const bool incremental = !sources.empty ();
+  vector<int> indices;
+  if (!incremental)
+    for (auto idx : vars)
+      indices.push_back (idx);
+  else
+    for (const auto &lit : sources)
+      indices.push_back (abs (lit));
+  erase_vector (sources);
+
+  PHASE ("decompose", stats.decompositions,
+         "starting depth first searches from %zd of %d variables",
+         indices.size (), max_var);
+
   // The binary implication graph might have disconnected components and
   // thus we have in general to start several depth first searches.
 
-  for (auto root_idx : vars) {
+  for (auto root_idx : indices) {
     if (unsat)
       break;
     if (!active (root_idx))
@@ -421,6 +446,23 @@ bool Internal::decompose_round () {
   erase_vector (scc);
   // delete [] dfs; need to postpone until after changing clauses...
 
+  if (incremental) {
+    for (auto idx : vars) {
+      if (unsat)
+        break;
+      if (!active (idx))
+        continue;
+      for (int sign = -1; sign <= 1; sign += 2) {
+        const int lit = sign * idx;
+        if (dfs[vlit (lit)].min == TRAVERSED)
+          continue;
+        assert (!reprs[vlit (lit)]);
+        reprs[vlit (lit)] = lit;
+      }
+    }
+  }
+  erase_vector (indices);
+
   // Only keep the representatives 'repr' mapping.
 
   PHASE ("decompose", stats.decompositions,
@@ -614,8 +656,13 @@ bool Internal::decompose_round () {
 #endif
     } else if (c->literals[0] != clause[0] || c->literals[1] != clause[1]) {
       LOG ("need new clause since at least one watched literal changed");
-      if (clause.size () == 2)
+      if (clause.size () == 2) {
         new_binary_clause = true;
+        if (roots) {
+          roots->push_back (clause[0]);
+          roots->push_back (clause[1]);
+        }
+      }
       size_t d_clause_idx = clauses.size ();
       Clause *d = new_clause_as (c);
       assert (clauses[d_clause_idx] == d);
@@ -641,8 +688,13 @@ bool Internal::decompose_round () {
         c->literals[l] = clause[l];
       int flushed = c->size - (int) l;
       if (flushed) {
-        if (l == 2)
+        if (l == 2) {
           new_binary_clause = true;
+          if (roots) {
+            roots->push_back (clause[0]);
+            roots->push_back (clause[1]);
+          }
+        }
         LOG ("flushed %d literals", flushed);
         (void) shrink_clause (c, l);
       } else if (likely_to_be_kept_clause (c))
@@ -740,9 +792,13 @@ bool Internal::decompose_round () {
 }
 
 void Internal::decompose () {
-  for (int round = 1; round <= opts.decomposerounds; round++)
-    if (!decompose_round ())
+  vector<int> roots, *incremental = opts.decomposeinc ? &roots : 0;
+  for (int round = 1; round <= opts.decomposerounds; round++) {
+    if (incremental && round > 1 && roots.empty ())
       break;
+    if (!decompose_round (incremental))
+      break;
+  }
 }
 
 } // namespace CaDiCaL
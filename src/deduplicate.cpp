@@ -167,4 +167,154 @@ void Internal::mark_duplicated_binary_clauses_as_garbage () {
   report ('2', !opts.reportall && !(subsumed + units));
 }
 
+/*------------------------------------------------------------------------*/
+
+// Duplicated clauses with more than two literals are produced by encoders
+// generating the same constraint several times and by incremental users
+// adding the same clauses again in later calls.  They waste watches as
+// well as space in the arena and the proof checker.  Since they are not
+// watched by both literals in the same watch list, they can not be found
+// by the watch list scan above.  Instead irredundant clauses are kept in
+// the persistent hash table 'duplicates' (see 'deduplicate.hpp') keyed by
+// a hash value of their literals which is independent of their order.
+// New irredundant clauses are only collected in 'new_clause' and checked
+// against the table the next time this function is called, which happens
+// at the start of 'solve' and during probing.  Thus the cost is linear in
+// the number of irredundant clauses added since the last time and not in
+// the size of the formula.  Of two identical clauses the older one in the
+// table is kept.  Clauses strengthened in place or which became redundant
+// are not found anymore or skipped, which is fine since we only want to
+// remove some duplicates and not all.
+
+static uint64_t dedup_hash_literal (int lit) {
+  uint64_t res = (unsigned) lit;
+  res *= 0x9e3779b97f4a7c15ull;
+  return res ^ (res >> 29);
+}
+
+static uint64_t dedup_hash_clause (const Clause *c) {
+  uint64_t res = c->size;
+  for (const auto &lit : *c)
+    res += dedup_hash_literal (lit);
+  return res;
+}
+
+// Find an irredundant clause identical to the marked clause 'c'.
+
+Clause *Internal::find_duplicated_clause (Clause *c, uint64_t hash) {
+  if (!duplicates.count)
+    return 0;
+  const auto &table = duplicates.table;
+  for (size_t pos = duplicates.first (hash); table[pos].clause;
+       pos = duplicates.next (pos)) {
+    if (table[pos].hash != hash)
+      continue;
+    Clause *d = table[pos].clause;
+    if (d->garbage)
+      continue;
+    if (d->redundant)
+      continue;
+    if (d->size != c->size)
+      continue;
+    bool same = true;
+    for (const auto &lit : *d)
+      if (marked (lit) <= 0) {
+        same = false;
+        break;
+      }
+    if (same)
+      return d;
+  }
+  return 0;
+}
+
+void Internal::mark_duplicated_clauses_as_garbage () {
+
+  if (!opts.deduplicate)
+    return;
+  if (unsat)
+    return;
+  if (terminated_asynchronously ())
+    return;
+  if (duplicates.added.empty ())
+    return;
+
+  assert (!level);
+
+  START (deduplicate);
+
+  int64_t checked = 0, removed = 0;
+  for (const auto &c : duplicates.added) {
+    if (c->garbage)
+      continue;
+    if (c->redundant)
+      continue;
+    if (c->size < 3)
+      continue;
+    checked++;
+    const uint64_t hash = dedup_hash_clause (c);
+    for (const auto &lit : *c)
+      mark (lit);
+    Clause *d = find_duplicated_clause (c, hash);
+    for (const auto &lit : *c)
+      unmark (lit);
+    if (d) {
+      LOG (c, "mark garbage duplicated");
+      LOG (d, "keeping duplicated");
+      stats.subsumed++;
+      stats.deduplicated++;
+      stats.deduplong++;
+      removed++;
+      mark_garbage (c);
+    } else
+      duplicates.insert (c, hash);
+  }
+  erase_vector (duplicates.added);
+
+  STOP (deduplicate);
+
+  PHASE ("deduplicate", stats.deduplications,
+         "removed %" PRId64 " duplicated clauses out of %" PRId64
+         " new clauses",
+         removed, checked);
+}
+
+// Garbage collection deletes garbage clauses and moves the others.  The
+// references to them are updated (or removed) and the table is rebuilt.
+
+inline static Clause *dedup_updated_clause (Clause *c) {
+  if (c->collect ())
+    return 0;
+  return c->moved ? c->copy : c;
+}
+
+void Internal::update_duplicated_clause_references () {
+  auto &added = duplicates.added;
+  const auto end = added.end ();
+  auto j = added.begin ();
+  for (auto i = j; i != end; i++) {
+    Clause *c = dedup_updated_clause (*i);
+    if (c)
+      *j++ = c;
+  }
+  added.resize (j - added.begin ());
+  vector<DuplicateEntry> entries;
+  duplicates.flush (entries);
+  for (const auto &e : entries) {
+    Clause *c = dedup_updated_clause (e.clause);
+    if (c)
+      duplicates.insert (c, e.hash);
+  }
+  LOG ("updated %zd duplicated clause references", duplicates.count);
+}
+
+// Compacting maps the literals of all clauses and thus their hash values.
+
+void Internal::rehash_duplicated_clauses () {
+  vector<DuplicateEntry> entries;
+  duplicates.flush (entries);
+  for (const auto &e : entries)
+    duplicates.insert (e.clause, dedup_hash_clause (e.clause));
+}
+
 } // namespace CaDiCaL
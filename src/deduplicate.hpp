@@ -0,0 +1,76 @@
+#ifndef _deduplicate_hpp_INCLUDED
+#define _deduplicate_hpp_INCLUDED
+
+namespace CaDiCaL {
+
+struct Clause;
+
+// Persistent hash table of irredundant clauses with more than two literals
+// used to remove duplicated clauses (see 'deduplicate.cpp').  The table
+// uses open addressing and linear probing and is kept at most half full.
+// Empty slots have a zero clause.  Entries are never removed individually
+// but only during garbage collection, where the table is rebuilt with the
+// moved clauses.  New irredundant clauses are collected on the 'added'
+// stack until they are checked against the table.
+
+struct DuplicateEntry {
+  Clause *clause;
+  uint64_t hash; // of the literals of 'clause' when inserted
+};
+
+struct DuplicateTable {
+
+  vector<DuplicateEntry> table;
+  vector<Clause *> added; // new clauses not checked yet
+  size_t count;
+
+  DuplicateTable () : count (0) {}
+
+  size_t first (uint64_t hash) const {
+    assert (!table.empty ());
+    return hash & (table.size () - 1);
+  }
+
+  size_t next (size_t pos) const { return (pos + 1) & (table.size () - 1); }
+
+  void enlarge () {
+    vector<DuplicateEntry> old;
+    old.swap (table);
+    DuplicateEntry empty;
+    empty.clause = 0;
+    empty.hash = 0;
+    table.resize (old.empty () ? 1024 : 2 * old.size (), empty);
+    for (const auto &e : old)
+      if (e.clause) {
+        size_t pos = first (e.hash);
+        while (table[pos].clause)
+          pos = next (pos);
+        table[pos] = e;
+      }
+  }
+
+  void insert (Clause *c, uint64_t hash) {
+    if (2 * (count + 1) > table.size ())
+      enlarge ();
+    size_t pos = first (hash);
+    while (table[pos].clause)
+      pos = next (pos);
+    table[pos].clause = c;
+    table[pos].hash = hash;
+    count++;
+  }
+
+  // Remove all entries, which are then inserted again.
+
+  void flush (vector<DuplicateEntry> &entries) {
+    for (const auto &e : table)
+      if (e.clause)
+        entries.push_back (e);
+    vector<DuplicateEntry> ().swap (table);
+    count = 0;
+  }
+};
+
+} // namespace CaDiCaL
+
+#endif
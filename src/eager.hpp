@@ -0,0 +1,65 @@
+#ifndef _eager_hpp_INCLUDED
+#define _eager_hpp_INCLUDED
+
+namespace CaDiCaL {
+
+struct Clause;
+
+// Index of recently learned clauses for eager subsumption.  The clauses
+// are kept in a ring buffer of 'opts.eagersubsumewin' slots together with
+// a 64-bit signature of their literals.  Literals are hashed to one of the
+// buckets, which list the positions (the number of clauses added before)
+// of recent clauses containing such a literal.  A clause subsumed by the
+// learned clause has to contain all of its literals and thus is found in
+// the smallest bucket of these literals.  Positions which left the window
+// are stale and flushed from a bucket while traversing it.  Since clauses
+// are deleted or moved during garbage collection the index is cleared
+// there.
+
+struct EagerIndex {
+
+  static const unsigned log2_buckets = 12;
+
+  vector<Clause *> clauses;         // ring buffer of learned clauses
+  vector<uint64_t> signatures;      // of the clauses in the ring buffer
+  vector<vector<uint64_t>> buckets; // positions of clauses with literal
+
+  uint64_t added; // number of clauses added so far
+  uint64_t start; // position of first valid clause
+
+  EagerIndex () : added (0), start (0) {}
+
+  static unsigned hash (int lit) {
+    const unsigned u = lit < 0 ? 2u * (unsigned) -lit + 1 : 2u * lit;
+    return (u * 2654435761u) >> (32 - log2_buckets);
+  }
+
+  static uint64_t signature (int lit) {
+    const uint64_t u = lit < 0 ? 2u * (unsigned) -lit + 1 : 2u * lit;
+    return 1ull << ((u * 0x9e3779b97f4a7c15ull) >> 58);
+  }
+
+  void init (size_t window) {
+    clauses.assign (window, 0);
+    signatures.assign (window, 0);
+    buckets.resize (1u << log2_buckets);
+    clear ();
+  }
+
+  void clear () {
+    for (auto &bucket : buckets)
+      bucket.clear ();
+    start = added;
+  }
+
+  // First position in the window.
+
+  uint64_t lower () const {
+    const uint64_t window = clauses.size ();
+    return added - start > window ? added - window : start;
+  }
+};
+
+} // namespace CaDiCaL
+
+#endif
@@ -16,6 +16,17 @@ namespace CaDiCaL {
 // and subsumption (which in turn also calls vivification and transitive
 // reduction of the binary implication graph).
 
+// Candidates are tried strictly one after the other.  Trying independent
+// candidates in parallel does not fit this single threaded library, which
+// is not reentrant.  Resolution and bound checks share the mark table, the
+// resolvent and LRAT chain buffers, statistics and the proof, and every
+// elimination adds resolvents, units and strengthened clauses, which
+// change occurrence lists and bounds of the following candidates anyhow.
+
+// The inverse technique, bounded variable addition, is not implemented.
+// It has to introduce fresh variables during inprocessing, which neither
+// the external solver nor the extension stack and proof tracers support.
+
 /*------------------------------------------------------------------------*/
 
 inline double Internal::compute_elim_score (unsigned lit) {
@@ -843,8 +854,10 @@ int Internal::elim_round (bool &completed) {
          "scheduled %" PRId64 " variables %.0f%% for elimination",
          scheduled, percent (scheduled, active ()));
 
-  // Connect irredundant clauses.
+  // Connect irredundant clauses.  Their occurrences have been counted
+  // exactly above, so the lists can be allocated with their final size.
   //
+  reserve_occs ();
   for (const auto &c : clauses)
     if (!c->garbage && !c->redundant)
       for (const auto &lit : *c)
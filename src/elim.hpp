@@ -15,6 +15,19 @@ struct elim_more {
 
 typedef heap<elim_more> ElimSchedule;
 
+// Gate clauses found for a variable are cached between elimination rounds
+// (see 'find_gate_clauses').  Since clause pointers change during garbage
+// collection and clauses might be strengthened or substituted in place, a
+// cached gate clause is identified by its id, size and literal hash.
+
+struct GateClause {
+  uint64_t id;
+  unsigned size;
+  unsigned hash;
+};
+
+typedef vector<GateClause> GateClauses;
+
 struct Eliminator {
 
   Internal *internal;
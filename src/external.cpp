@@ -34,7 +34,8 @@ void External::init (int new_max_var) {
     return;
   int new_vars = new_max_var - max_var;
   int old_internal_max_var = internal->max_var;
-  int new_internal_max_var = old_internal_max_var + new_vars;
+  int reused_vars = min ((size_t) new_vars, internal->reusable.size ());
+  int new_internal_max_var = old_internal_max_var + new_vars - reused_vars;
   internal->init_vars (new_internal_max_var);
   if ((size_t) new_max_var >= vsize)
     enlarge (new_max_var);
@@ -52,17 +53,23 @@ void External::init (int new_max_var) {
     assert (internal->i2e.size () == (size_t) old_internal_max_var + 1);
   }
   unsigned iidx = old_internal_max_var + 1, eidx;
-  for (eidx = max_var + 1u; eidx <= (unsigned) new_max_var;
-       eidx++, iidx++) {
-    LOG ("mapping external %u to internal %u", eidx, iidx);
+  for (eidx = max_var + 1u; eidx <= (unsigned) new_max_var; eidx++) {
     assert (e2i.size () == eidx);
-    e2i.push_back (iidx);
+    const int reused = internal->reuse_recycled_variable ();
+    if (reused) {
+      LOG ("mapping external %u to reused internal %d", eidx, reused);
+      e2i.push_back (reused);
+      internal->i2e[reused] = eidx;
+    } else {
+      LOG ("mapping external %u to internal %u", eidx, iidx);
+      e2i.push_back (iidx);
+      internal->i2e.push_back (eidx);
+      assert (internal->i2e[iidx] == (int) eidx);
+      iidx++;
+    }
     ext_units.push_back (0);
     ext_units.push_back (0);
     ext_flags.push_back (0);
-    internal->i2e.push_back (eidx);
-    assert (internal->i2e[iidx] == (int) eidx);
-    assert (e2i[eidx] == (int) iidx);
   }
   if (new_max_var >= (int64_t) is_observed.size ())
     is_observed.resize (1 + (size_t) new_max_var, false);
@@ -113,7 +120,13 @@ int External::internalize (int elit) {
     ilit = e2i[eidx];
     if (elit < 0)
       ilit = -ilit;
-    if (!ilit) {
+    if (!ilit && (ilit = internal->reuse_recycled_variable ())) {
+      LOG ("mapping external %d to reused internal %d", eidx, ilit);
+      e2i[eidx] = ilit;
+      internal->i2e[ilit] = eidx;
+      if (elit < 0)
+        ilit = -ilit;
+    } else if (!ilit) {
       assert (internal->max_var < INT_MAX);
       ilit = internal->max_var + 1u;
       internal->init_vars (ilit);
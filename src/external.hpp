@@ -358,6 +358,10 @@ struct External {
 
   void copy_flags (External &other) const;
 
+  // Clone complete state into fresh 'other' (see 'clone.cpp').
+  //
+  void clone (External &other);
+
   /*----------------------------------------------------------------------*/
 
   // Check solver behaves as expected during testing and debugging.
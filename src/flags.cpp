@@ -22,6 +22,7 @@ void Internal::mark_fixed (int lit) {
   stats.active--;
   assert (!active (lit));
   assert (f.fixed ());
+  mark_retired (vidx (lit));
 }
 
 void Internal::mark_eliminated (int lit) {
@@ -36,6 +37,7 @@ void Internal::mark_eliminated (int lit) {
   stats.active--;
   assert (!active (lit));
   assert (f.eliminated ());
+  mark_retired (vidx (lit));
 }
 
 void Internal::mark_pure (int lit) {
@@ -50,6 +52,7 @@ void Internal::mark_pure (int lit) {
   stats.active--;
   assert (!active (lit));
   assert (f.pure ());
+  mark_retired (vidx (lit));
 }
 
 void Internal::mark_substituted (int lit) {
@@ -64,6 +67,7 @@ void Internal::mark_substituted (int lit) {
   stats.active--;
   assert (!active (lit));
   assert (f.substituted ());
+  mark_retired (vidx (lit));
 }
 
 void Internal::mark_active (int lit) {
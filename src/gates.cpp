@@ -625,6 +625,11 @@ Clause *Internal::find_clause (const vector<int> &lits) {
   return 0;
 }
 
+// XOR gates are only used as definitions for variable elimination.  There
+// is no Gaussian elimination on them, since units and equivalences derived
+// from the sum of several XOR constraints need resolution proofs which are
+// in general exponential in the size of the constraints.
+
 void Internal::find_xor_gate (Eliminator &eliminator, int pivot) {
 
   if (!opts.elimxors)
@@ -728,6 +733,65 @@ void Internal::find_xor_gate (Eliminator &eliminator, int pivot) {
 // might detect units, which are propagated.  This might assign the pivot or
 // even produce the empty clause.
 
+// Finding gates is repeated for the same variable whenever it is tried
+// again in later elimination rounds, which for instance happens for all
+// variables after increasing the elimination bound.  Therefore we cache
+// the gate clauses found for a variable.  Before reusing them we check
+// that all of them still occur unchanged, which is the case if a non
+// garbage clause with the same id, size and literal hash is found in the
+// occurrence lists of the pivot.  The gate is a property of these clauses
+// alone, thus reusing them is sound even if other clauses changed.
+// Otherwise the cached entry is dropped and gates are searched again.
+
+unsigned Internal::gate_clause_hash (Clause *c) {
+  unsigned res = 0;
+  for (const auto &lit : *c) // Independent of literal order.
+    res += 2654435761u * (unsigned) lit;
+  return res;
+}
+
+bool Internal::reuse_gate_clauses (Eliminator &eliminator, int pivot) {
+  const int idx = vidx (pivot);
+  if ((size_t) idx >= gatetab.size ())
+    return false;
+  GateClauses &cached = gatetab[idx];
+  if (cached.empty ())
+    return false;
+  assert (eliminator.gates.empty ());
+  for (const auto &g : cached) {
+    Clause *found = 0;
+    for (int sign = -1; !found && sign <= 1; sign += 2)
+      for (const auto &c : occs (sign * idx))
+        if (!c->garbage && c->id == g.id) {
+          found = c;
+          break;
+        }
+    if (!found || found->gate || (unsigned) found->size != g.size ||
+        gate_clause_hash (found) != g.hash) {
+      LOG ("cached gate clause[%" PRIu64 "] of %d invalid", g.id, idx);
+      unmark_gate_clauses (eliminator);
+      erase_vector (cached);
+      return false;
+    }
+    found->gate = true;
+    eliminator.gates.push_back (found);
+  }
+  LOG ("reusing %zd cached gate clauses of %d", cached.size (), idx);
+  stats.elimcached++;
+  return true;
+}
+
+void Internal::cache_gate_clauses (Eliminator &eliminator, int pivot) {
+  const int idx = vidx (pivot);
+  if ((size_t) idx >= gatetab.size ())
+    gatetab.resize (1u + (size_t) max_var);
+  GateClauses &cached = gatetab[idx];
+  cached.clear ();
+  for (const auto &c : eliminator.gates)
+    cached.push_back ({c->id, (unsigned) c->size, gate_clause_hash (c)});
+  LOG ("cached %zd gate clauses of %d", cached.size (), idx);
+}
+
 void Internal::find_gate_clauses (Eliminator &eliminator, int pivot) {
   if (!opts.elimsubst)
     return;
@@ -739,11 +803,17 @@ void Internal::find_gate_clauses (Eliminator &eliminator, int pivot) {
 
   assert (eliminator.gates.empty ());
 
+  if (opts.elimcache && reuse_gate_clauses (eliminator, pivot))
+    return;
+
   find_equivalence (eliminator, pivot);
   find_and_gate (eliminator, pivot);
   find_and_gate (eliminator, -pivot);
   find_if_then_else (eliminator, pivot);
   find_xor_gate (eliminator, pivot);
+
+  if (opts.elimcache && !unsat && !eliminator.gates.empty ())
+    cache_gate_clauses (eliminator, pivot);
 }
 
 void Internal::unmark_gate_clauses (Eliminator &eliminator) {
@@ -308,6 +308,134 @@ bool Internal::instantiate_candidate (int lit, Clause *c) {
 
 /*------------------------------------------------------------------------*/
 
+// Unassign all literals assigned after the first 'before' on the trail.
+
+inline void Internal::inst_backtrack (size_t before) {
+  while (trail.size () > before) {
+    const int other = trail.back ();
+    LOG ("instantiate unassign %d", other);
+    trail.pop_back ();
+    assert (val (other) > 0);
+    num_assigned--;
+    set_val (other, 0);
+  }
+  propagated = before;
+}
+
+// Several candidate literals of the same clause are tried in one batch.
+// The literals of the clause which are not candidates are assumed to be
+// false and propagated only once on the first decision level.  Then each
+// candidate is assumed to be true and the other remaining candidates to be
+// false on the second decision level.  A conflict there shows that the
+// candidate can be removed.  For later candidates of the same batch the
+// removed ones are neither assumed nor counted anymore.  This is exactly
+// the same check as done by individual sequential attempts, and thus all
+// the removed literals can be dropped at the end one after the other, each
+// step being justified by reverse unit propagation.  Since this does not
+// produce individual resolution chains it is only used without LRAT.
+
+int Internal::instantiate_batch (Clause *c, vector<int> &lits) {
+  assert (!lrat);
+  assert (lits.size () > 1);
+  if (c->garbage)
+    return 0;
+  assert (!level);
+  bool satisfied = false, inactive = false;
+  int unassigned = 0;
+  for (const auto &other : *c) {
+    const signed char tmp = val (other);
+    if (tmp > 0) {
+      satisfied = true;
+      break;
+    }
+    if (!tmp && !active (other)) {
+      inactive = true;
+      break;
+    }
+    if (!tmp)
+      unassigned++;
+  }
+  if (inactive || satisfied)
+    return 0;
+  for (const auto &lit : lits) {
+    assert (active (lit));
+    assert (find (c->begin (), c->end (), lit) != c->end ());
+    mark (lit);
+  }
+  size_t before = trail.size ();
+  assert (propagated == before);
+  LOG (c, "trying to instantiate %zd literals in", lits.size ());
+  c->instantiated = true;
+  stats.instbatches++;
+  level++;
+  for (const auto &other : *c)
+    if (!val (other) && !marked (other))
+      inst_assign (-other); // Assume other to false.
+  const bool ok = inst_propagate ();
+  unmark (lits);
+  if (!ok) {
+    LOG ("shared assumptions conflict");
+    inst_backtrack (before);
+    level = 0;
+    int res = 0;
+    for (const auto &lit : lits)
+      if (instantiate_candidate (lit, c))
+        res++;
+    return res;
+  }
+  vector<int> removed;
+  const size_t shared = trail.size ();
+  for (const auto &lit : lits) {
+    if (unassigned < 3)
+      break;
+    stats.instried++;
+    const signed char tmp = val (lit);
+    if (tmp > 0)
+      continue;
+    if (!tmp) {
+      level++;
+      inst_assign (lit); // Assume 'lit' to true.
+      for (const auto &other : lits) {
+        if (other == lit || val (other))
+          continue;
+        const auto end = removed.end ();
+        if (find (removed.begin (), end, other) != end)
+          continue;
+        inst_assign (-other); // Assume other candidate to false.
+      }
+      const bool ok = inst_propagate ();
+      inst_backtrack (shared);
+      level--;
+      if (ok)
+        continue;
+    }
+    LOG ("instantiating %d succeeded", lit);
+    removed.push_back (lit);
+    unassigned--;
+  }
+  inst_chain.clear ();
+  inst_backtrack (before);
+  assert (level == 1);
+  level = 0;
+  if (removed.empty ())
+    return 0;
+  unwatch_clause (c);
+  for (const auto &lit : removed) {
+    strengthen_clause (c, lit);
+    stats.instantiated++;
+  }
+  watch_clause (c);
+  assert (c->size > 1);
+  return removed.size ();
+}
+
+bool Instantiator::candidate_clause_smaller::operator() (
+    const Candidate &a, const Candidate &b) const {
+  return a.clause->id < b.clause->id;
+}
+
+/*------------------------------------------------------------------------*/
+
 // Try to instantiate all candidates collected before through the
 // 'collect_instantiation_candidates' routine.
 
@@ -333,6 +461,12 @@ void Internal::instantiate (Instantiator &instantiator) {
          "attempting to instantiate %" PRId64
          " candidate literal clause pairs",
          candidates);
+  const bool batch = opts.instantiatebatch && !lrat;
+  if (batch)
+    stable_sort (instantiator.candidates.begin (),
+                 instantiator.candidates.end (),
+                 Instantiator::candidate_clause_smaller ());
+  vector<int> lits;
   while (!unsat && !terminated_asynchronously () &&
          !instantiator.candidates.empty ()) {
     Instantiator::Candidate cand = instantiator.candidates.back ();
@@ -340,6 +474,29 @@ void Internal::instantiate (Instantiator &instantiator) {
 #ifndef QUIET
     tried++;
 #endif
+    if (batch) {
+      assert (lits.empty ());
+      if (active (cand.lit))
+        lits.push_back (cand.lit);
+      while (!instantiator.candidates.empty () &&
+             instantiator.candidates.back ().clause == cand.clause) {
+        const int other = instantiator.candidates.back ().lit;
+        instantiator.candidates.pop_back ();
+#ifndef QUIET
+        tried++;
+#endif
+        if (active (other))
+          lits.push_back (other);
+      }
+      if (lits.size () > 1) {
+        LOG (cand.clause, "trying to instantiate %zd literals in",
+             lits.size ());
+        instantiated += instantiate_batch (cand.clause, lits);
+        lits.clear ();
+        continue;
+      }
+      lits.clear ();
+    }
     if (!active (cand.lit))
       continue;
     LOG (cand.clause,
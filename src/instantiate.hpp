@@ -30,6 +30,12 @@ class Instantiator {
         : lit (l), size (s), negoccs (n), clause (c) {}
   };
 
+  // Group candidates of the same clause for batched instantiation.
+  //
+  struct candidate_clause_smaller {
+    bool operator() (const Candidate &a, const Candidate &b) const;
+  };
+
   vector<Candidate> candidates;
 
 public:
@@ -12,6 +12,7 @@ Internal::Internal ()
       searching_lucky_phases (false), stable (false), reported (false),
       external_prop (false), did_external_prop (false),
       external_prop_is_lazy (true), rephased (0), vsize (0), max_var (0),
+      fixed_anchor (0),
       clause_id (0), original_id (0), reserved_ids (0), conflict_id (0),
       concluded (false), lrat (false), level (0), vals (0), score_inc (1.0),
       scores (this), conflict (0), ignore (0),
@@ -159,6 +160,10 @@ void Internal::init_vars (int new_max_var) {
   init_queue (old_max_var, new_max_var);
   init_scores (old_max_var, new_max_var);
   int initialized = new_max_var - old_max_var;
+  // New variables start with their 'subsume' and 'block' flags set (see
+  // 'Flags'), which has to be counted to trigger 'subsume' and 'block'.
+  stats.mark.subsume += initialized;
+  stats.mark.block += 2 * initialized;
   stats.vars += initialized;
   stats.unused += initialized;
   stats.inactive += initialized;
@@ -263,6 +268,8 @@ int Internal::cdcl_loop_with_inprocessing () {
       subsume (); // subsumption algorithm
     else if (eliminating ())
       elim (); // variable elimination
+    else if (recycling ())
+      recycle (); // recycle inactive variables
     else if (compacting ())
       compact (); // collect variables
     else if (conditioning ())
@@ -344,6 +351,10 @@ void Internal::init_preprocessing_limits () {
     lim.compact = stats.conflicts + opts.compactint;
     LOG ("initial compact limit %" PRId64 " increment %" PRId64 "",
          lim.compact, lim.compact - stats.conflicts);
+
+    lim.recycle = stats.conflicts + opts.recycleint;
+    LOG ("initial recycle limit %" PRId64 " increment %" PRId64 "",
+         lim.recycle, lim.recycle - stats.conflicts);
   }
 
   /*----------------------------------------------------------------------*/
@@ -560,6 +571,8 @@ int Internal::preprocess () {
       break;
   if (unsat)
     return 20;
+  if (lim.preprocessing && opts.release)
+    release_memory ();
   return 0;
 }
 
@@ -715,6 +728,8 @@ int Internal::solve (bool preprocess_only) {
     if (!preprocess_only)
       init_search_limits ();
   }
+  if (!res && !level)
+    mark_duplicated_clauses_as_garbage ();
   if (!res && !level)
     res = preprocess ();
   if (!preprocess_only) {
@@ -730,6 +745,8 @@ int Internal::solve (bool preprocess_only) {
   }
   finalize (res);
   reset_solving ();
+  if (opts.release > 1)
+    release_memory ();
   report_solving (res);
   STOP (solve);
   return res;
@@ -859,7 +876,7 @@ void Internal::finalize (int res) {
   // See the discussion in 'propagate' on why garbage binary clauses stick
   // around.
   for (const auto &c : clauses)
-    if (!c->garbage || c->size == 2)
+    if (!c->garbage || (c->size == 2 && !c->flushed))
       proof->finalize_clause (c);
 
   // finalize conflict and proof
@@ -57,7 +57,9 @@ extern "C" {
 #include "contract.hpp"
 #include "cover.hpp"
 #include "decompose.hpp"
+#include "deduplicate.hpp"
 #include "drattracer.hpp"
+#include "eager.hpp"
 #include "elim.hpp"
 #include "ema.hpp"
 #include "external.hpp"
@@ -92,6 +94,7 @@ extern "C" {
 #include "score.hpp"
 #include "stats.hpp"
 #include "terminal.hpp"
+#include "ternary.hpp"
 #include "tracer.hpp"
 #include "util.hpp"
 #include "var.hpp"
@@ -176,6 +179,7 @@ struct Internal {
   Reluctant reluctant;        // restart counter in stable mode
   size_t vsize;               // actually allocated variable data size
   int max_var;                // internal maximum variable index
+  int fixed_anchor;           // fixed variable representing recycled units
   uint64_t clause_id;         // last used id for clauses
   uint64_t original_id;       // ids for original clauses to produce LRAT
   uint64_t reserved_ids;      // number of reserved ids for original clauses
@@ -212,6 +216,10 @@ struct Internal {
   vector<int> ptab;             // table for caching probing attempts
   vector<int64_t> ntab;         // number of one-sided occurrences table
   vector<Bins> big;             // binary implication graph
+  vector<GateClauses> gatetab;  // cached gate clauses [1,max_var]
+  TernaryClauses ternaries;     // existing clauses in 'ternary_round'
+  EagerIndex eager;             // recently learned for eager subsumption
+  DuplicateTable duplicates;    // irredundant for deduplication
   vector<Watches> wtab;         // table of watches for all literals
   Clause *conflict;             // set in 'propagation', reset in 'analyze'
   Clause *ignore;               // ignored during 'vivify_propagate'
@@ -246,6 +254,9 @@ struct Internal {
   size_t num_assigned; // check for satisfied
 
   vector<int> probes;       // remaining scheduled probes
+  vector<int> retired;      // inactive variables to be recycled
+  vector<int> reusable;     // recycled unused variables
+  vector<Clause *> pending; // new garbage binary clauses
   vector<Level> control;    // 'level + 1 == control.size ()'
   vector<Clause *> clauses; // ordered collection of all clauses
   Averages averages;        // glue, size, jump moving averages
@@ -681,6 +692,7 @@ struct Internal {
   // Use last learned clause to subsume some more.
   //
   void eagerly_subsume_recently_learned_clauses (Clause *);
+  void eagerly_subsume_indexed_learned_clauses (Clause *);
 
   // Restarting policy in 'restart.cc'.
   //
@@ -769,6 +781,7 @@ struct Internal {
   void init_occs ();
   void init_bins ();
   void init_noccs ();
+  void reserve_occs ();
   void reset_occs ();
   void reset_bins ();
   void reset_noccs ();
@@ -787,7 +800,8 @@ struct Internal {
   void strengthen_clause (Clause *, int);
   void subsume_clause (Clause *subsuming, Clause *subsumed);
   int subsume_check (Clause *subsuming, Clause *subsumed);
-  int try_to_subsume_clause (Clause *, vector<Clause *> &shrunken);
+  int try_to_subsume_clause (Clause *, vector<Clause *> &shrunken,
+                             const vector<Sigs> &);
   void reset_subsume_bits ();
   bool subsume_round ();
   void subsume (bool update_limits = true);
@@ -795,11 +809,13 @@ struct Internal {
   // Covered clause elimination of large clauses.
   //
   void covered_literal_addition (int lit, Coveror &);
-  void asymmetric_literal_addition (int lit, Coveror &);
+  void asymmetric_literal_addition (int lit, Clause *reason, Coveror &);
   void cover_push_extension (int lit, Coveror &);
   bool cover_propagate_asymmetric (int lit, Clause *ignore, Coveror &);
   bool cover_propagate_covered (int lit, Coveror &);
-  bool cover_clause (Clause *c, Coveror &);
+  void cover_backtrack (size_t size, Coveror &);
+  bool cover_assume_prefix (Clause *c, const int *lits, Coveror &);
+  bool cover_clause (Clause *c, const int *lits, Coveror &);
   int64_t cover_round ();
   bool cover ();
 
@@ -825,8 +841,32 @@ struct Internal {
   bool compacting ();
   void compact ();
 
+  // Recycling inactive variables instead of compacting in 'recycle.cpp'.
+  //
+  bool recycling ();
+  void mark_retired (int idx);
+  bool disconnect_retired_variable (int idx);
+  void reset_recycled_variable (int idx);
+  void recycle ();
+  int reuse_recycled_variable ();
+
+  // Releasing memory kept at its peak capacity in 'release.cpp'.
+  //
+  size_t release_watches ();
+  size_t release_scratch_vectors ();
+  size_t release_persistent_tables ();
+  void release_memory ();
+
+  // Cloning the complete state into another solver in 'clone.cpp'.
+  //
+  void clone_clauses (Internal &other) const;
+  void clone (Internal &other);
+
   // Transitive reduction of binary implication graph in 'transred.cpp'
   //
+  void transred_bfs (int64_t limit, int64_t &propagations, int64_t &units,
+                     int64_t &removed);
+  int64_t transred_bits (int64_t limit, int64_t &propagations);
   void transred ();
 
   // We monitor the maximum size and glue of clauses during 'reduce' and
@@ -993,6 +1033,9 @@ struct Internal {
   void find_if_then_else (Eliminator &, int pivot);
 
   Clause *find_binary_clause (int, int);
+  unsigned gate_clause_hash (Clause *);
+  bool reuse_gate_clauses (Eliminator &, int pivot);
+  void cache_gate_clauses (Eliminator &, int pivot);
   void find_gate_clauses (Eliminator &, int pivot);
   void unmark_gate_clauses (Eliminator &);
 
@@ -1024,12 +1067,15 @@ struct Internal {
   bool inst_propagate ();
   void collect_instantiation_candidates (Instantiator &);
   bool instantiate_candidate (int lit, Clause *);
+  void inst_backtrack (size_t before);
+  int instantiate_batch (Clause *, vector<int> &lits);
   void instantiate (Instantiator &);
 
   void new_trail_level (int lit);
 
   // Hyper ternary resolution.
   //
+  void ternary_add_clause (Clause *);
   bool ternary_find_binary_clause (int, int);
   bool ternary_find_ternary_clause (int, int, int);
   Clause *new_hyper_ternary_resolved_clause (bool red);
@@ -1048,6 +1094,10 @@ struct Internal {
   void probe_assign_decision (int lit);
   void probe_assign (int lit, int parent);
   void mark_duplicated_binary_clauses_as_garbage ();
+  Clause *find_duplicated_clause (Clause *, uint64_t hash);
+  void mark_duplicated_clauses_as_garbage ();
+  void update_duplicated_clause_references ();
+  void rehash_duplicated_clauses ();
   int get_parent_reason_literal (int lit);
   void set_parent_reason_literal (int lit, int reason);
   void clean_probehbr_lrat ();
@@ -1064,6 +1114,9 @@ struct Internal {
   void generate_probes ();
   void flush_probes ();
   int next_probe ();
+  int probe_tree_child (int probe);
+  void probe_tree_schedule ();
+  bool probe_tree (int probe);
   bool probe_round ();
   void probe (bool update_limits = true);
 
@@ -1085,7 +1138,7 @@ struct Internal {
                               bool invert = false);
   vector<Clause *> decompose_analyze_binary_clauses (DFS *dfs, int from);
   void decompose_analyze_binary_chain (DFS *dfs, int);
-  bool decompose_round ();
+  bool decompose_round (vector<int> *roots = 0);
   void decompose ();
 
   void reset_limits (); // Reset after 'solve' call.
@@ -1304,8 +1357,14 @@ struct Internal {
           LOG ("variable %d is observed, can not be completely molten",
                idx);
           ref++;
-        } else
+        } else {
           LOG ("variable %d completely molten", idx);
+          // Frozen literals keep their 'block' mark but are skipped in
+          // 'block' which thus has to be rescheduled now.
+          //
+          if (flags (idx).block)
+            stats.mark.block++;
+        }
       } else
         LOG ("variable %d melted once but remains frozen %u times", lit,
              ref);
@@ -17,6 +17,7 @@ struct Limit {
   int64_t elim;      // conflict limit for next 'elim'
   int64_t flush;     // conflict limit for next 'flush'
   int64_t probe;     // conflict limit for next 'probe'
+  int64_t recycle;   // conflict limit for next 'recycle'
   int64_t reduce;    // conflict limit for next 'reduce'
   int64_t rephase;   // conflict limit for next 'rephase'
   int64_t report;    // report limit for header
@@ -58,7 +59,7 @@ struct Last {
   } reduce, rephase;
   struct {
     int64_t marked;
-  } ternary;
+  } ternary, subsume, block;
   struct {
     int64_t fixed;
   } collect;
@@ -1045,8 +1045,11 @@ struct Call {
     FLUSHPROOFTRACE = shift (34),
     CLOSEPROOFTRACE = shift (35),
 
+    RELEASE = shift (36),
+
     ALWAYS = VARS | ACTIVE | REDUNDANT | IRREDUNDANT | FREEZE | FROZEN |
-             MELT | LIMIT | OPTIMIZE | DUMP | STATS | RESERVE | FIXED,
+             MELT | LIMIT | OPTIMIZE | DUMP | STATS | RESERVE | FIXED |
+             RELEASE,
 
     CONFIG = INIT | SET | CONFIGURE | ALWAYS | TRACEPROOF,
     BEFORE =
@@ -1189,6 +1192,14 @@ struct OptimizeCall : public Call {
   const char *keyword () { return "optimize"; }
 };
 
+struct ReleaseCall : public Call {
+  ReleaseCall () : Call (RELEASE) {}
+  void execute (Solver *&s) { s->release_memory (); }
+  void print (ostream &o) { o << "release_memory" << endl; }
+  Call *copy () { return new ReleaseCall (); }
+  const char *keyword () { return "release_memory"; }
+};
+
 struct ResetCall : public Call {
   ResetCall () : Call (RESET) {}
   void execute (Solver *&s) {
@@ -1948,6 +1959,8 @@ void Trace::generate_queries (Random &random) {
     push_back (new RedundantCall ());
   if (random.generate_double () < 0.02)
     push_back (new IrredundantCall ());
+  if (random.generate_double () < 0.01)
+    push_back (new ReleaseCall ());
 }
 
 /*------------------------------------------------------------------------*/
@@ -2929,6 +2942,7 @@ static bool is_basic (Call *c) {
   case Call::MELT:
   case Call::LIMIT:
   case Call::OPTIMIZE:
+  case Call::RELEASE:
   case Call::OBSERVE:
     return true;
   default:
@@ -3725,6 +3739,10 @@ void Reader::parse () {
       if (first)
         error ("additional argument '%s' to 'stats'", first);
       c = new StatsCall ();
+    } else if (!strcmp (keyword, "release_memory")) {
+      if (first)
+        error ("additional argument '%s' to 'release_memory'", first);
+      c = new ReleaseCall ();
     } else if (!strcmp (keyword, "reset")) {
       if (first)
         error ("additional argument '%s' to 'reset'", first);
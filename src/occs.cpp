@@ -12,6 +12,21 @@ void Internal::init_occs () {
   LOG ("initialized occurrence lists");
 }
 
+// Connecting clauses with 'push_back' grows each occurrence list
+// logarithmically many times, which for millions of literals amounts to
+// many reallocations and copying.  If the exact number of occurrences of
+// each literal has been counted in a first pass in 'noccs' the lists
+// can be allocated with their final size in one go instead.
+
+void Internal::reserve_occs () {
+  for (auto lit : lits) {
+    const int64_t n = noccs (lit);
+    if (n)
+      occs (lit).reserve (n);
+  }
+  LOG ("reserved occurrence lists");
+}
+
 void Internal::reset_occs () {
   assert (occurring ());
   erase_vector (otab);
@@ -13,6 +13,10 @@ using namespace std;
 
 typedef vector<Clause *> Occs;
 
+// Clause signatures stored in parallel to occurrence lists in 'subsume'.
+
+typedef vector<uint64_t> Sigs;
+
 inline void shrink_occs (Occs &os) { shrink_vector (os); }
 inline void erase_occs (Occs &os) { erase_vector (os); }
 
@@ -24,7 +24,7 @@
 OPTION( arena,             1,  0,  1,0,0,1, "allocate clauses in arena") \
 OPTION( arenacompact,      1,  0,  1,0,0,1, "keep clauses compact") \
 OPTION( arenasort,         1,  0,  1,0,0,1, "sort clauses in arena") \
-OPTION( arenatype,         3,  1,  3,0,0,1, "1=clause, 2=var, 3=queue") \
+OPTION( arenatype,         3,  1,  4,0,0,1, "1=clause, 2=var, 3=queue, 4=trail") \
 OPTION( binary,            1,  0,  1,0,0,1, "use binary proof format") \
 OPTION( block,             0,  0,  1,0,1,1, "blocked clause elimination") \
 OPTION( blockmaxclslim,  1e5,  1,2e9,2,0,1, "maximum clause size") \
@@ -51,7 +51,7 @@ OPTION( compactmin,      1e2,  1,2e9,0,0,1, "minimum inactive limit") \
 OPTION( condition,         0,  0,  1,0,0,1, "globally blocked clause elim") \
 OPTION( conditionint,    1e4,  1,2e9,0,0,1, "initial conflict interval") \
 OPTION( conditionmaxeff, 1e7,  0,2e9,1,0,1, "maximum condition efficiency") \
-OPTION( conditionmaxrat, 100,  1,2e9,1,0,1, "maximum clause variable ratio") \
+OPTION( conditionmaxrat, 100,  1,2e9,1,0,1, "undelayed clause variable ratio") \
 OPTION( conditionmineff, 1e6,  0,2e9,1,0,1, "minimum condition efficiency") \
 OPTION( conditionreleff, 100,  1,1e5,0,0,1, "relative efficiency per mille") \
 OPTION( cover,             0,  0,  1,0,1,1, "covered clause elimination") \
@@ -59,18 +59,23 @@ OPTION( covermaxclslim,  1e5,  1,2e9,2,0,1, "maximum clause size") \
 OPTION( covermaxeff,     1e8,  0,2e9,1,0,1, "maximum cover efficiency") \
 OPTION( coverminclslim,    2,  2,2e9,0,0,1, "minimum clause size") \
 OPTION( covermineff,     1e6,  0,2e9,1,0,1, "minimum cover efficiency") \
+OPTION( coverprefix,       1,  0,  1,0,0,1, "reuse assumed prefixes") \
 OPTION( coverreleff,       4,  1,1e5,1,0,1, "relative efficiency per mille") \
 OPTION( decompose,         1,  0,  1,0,1,1, "decompose BIG in SCCs and ELS") \
+OPTION( decomposeinc,      1,  0,  1,0,0,1, "incremental decompose rounds") \
 OPTION( decomposerounds,   2,  1, 16,1,0,1, "number of decompose rounds") \
-OPTION( deduplicate,       1,  0,  1,0,1,1, "remove duplicated binaries") \
+OPTION( deduplicate,       1,  0,  1,0,1,1, "remove duplicated clauses") \
 OPTION( eagersubsume,      1,  0,  1,0,0,1, "subsume recently learned") \
+OPTION( eagersubsumeidx,   1,  0,  1,0,0,1, "index recently learned") \
 OPTION( eagersubsumelim,  20,  1,1e3,0,0,1, "limit on subsumed candidates") \
+OPTION( eagersubsumewin, 1e3,  1,1e5,0,0,1, "window of indexed learned") \
 OPTION( elim,              1,  0,  1,0,1,1, "bounded variable elimination") \
 OPTION( elimands,          1,  0,  1,0,0,1, "find AND gates") \
 OPTION( elimaxeff,       2e9,  0,2e9,1,0,1, "maximum elimination efficiency") \
 OPTION( elimbackward,      1,  0,  1,0,0,1, "eager backward subsumption") \
 OPTION( elimboundmax,     16, -1,2e6,1,0,1, "maximum elimination bound") \
 OPTION( elimboundmin,      0, -1,2e6,0,0,1, "minimum elimination bound") \
+OPTION( elimcache,         1,  0,  1,0,0,1, "cache gates between rounds") \
 OPTION( elimclslim,      1e2,  2,2e9,2,0,1, "resolvent size limit") \
 OPTION( elimequivs,        1,  0,  1,0,0,1, "find equivalence gates") \
 OPTION( elimineff,       1e7,  0,2e9,1,0,1, "minimum elimination efficiency") \
@@ -103,6 +108,7 @@ OPTION( ilb,               1,  0,  1,0,0,1, "ILB (incremental lazy backtrack)")
 OPTION( ilbassumptions,    1,  0,  1,0,0,1, "trail reuse for assumptions (ILB-like)") \
 OPTION( inprocessing,      1,  0,  1,0,0,1, "enable inprocessing") \
 OPTION( instantiate,       0,  0,  1,0,1,1, "variable instantiation") \
+OPTION( instantiatebatch,  1,  0,  1,0,0,1, "batch candidates of clause") \
 OPTION( instantiateclslim, 3,  2,2e9,0,0,1, "minimum clause size") \
 OPTION( instantiateocclim, 1,  1,2e9,2,0,1, "maximum occurrence limit") \
 OPTION( instantiateonce,   1,  0,  1,0,0,1, "instantiate each clause once") \
@@ -121,15 +127,21 @@ OPTION( probemaxeff,     1e8,  0,2e9,1,0,1, "maximum probing efficiency") \
 OPTION( probemineff,     1e6,  0,2e9,1,0,1, "minimum probing efficiency") \
 OPTION( probereleff,      20,  1,1e5,1,0,1, "relative efficiency per mille") \
 OPTION( proberounds,       1,  1, 16,1,0,1, "probing rounds" ) \
+OPTION( probetree,         0,  0,  1,0,0,1, "share propagation of probes") \
 OPTION( profile,           2,  0,  4,0,0,0, "profiling level") \
 QUTOPT( quiet,             0,  0,  1,0,0,0, "disable all messages") \
 OPTION( radixsortlim,    800,  0,2e9,0,0,1, "radix sort limit") \
 OPTION( realtime,          0,  0,  1,0,0,0, "real instead of process time") \
+OPTION( recycle,           1,  0,  1,0,0,1, "recycle inactive variables") \
+OPTION( recycleint,      1e3,  1,2e9,0,0,1, "recycling interval") \
+OPTION( recyclemin,      1e2,  1,2e9,0,0,1, "minimum retired variables") \
 OPTION( reduce,            1,  0,  1,0,0,1, "reduce useless clauses") \
 OPTION( reduceint,       300, 10,1e6,0,0,1, "reduce interval") \
 OPTION( reducetarget,     75, 10,1e2,0,0,1, "reduce fraction in percent") \
 OPTION( reducetier1glue,   2,  1,2e9,0,0,1, "glue of kept learned clauses") \
 OPTION( reducetier2glue,   6,  1,2e9,0,0,1, "glue of tier two clauses") \
+OPTION( release,           1,  0,  2,0,0,1, "release memory (2=after solve)") \
+OPTION( releaseslack,    100,  0,1e4,0,0,1, "released watch slack in percent") \
 OPTION( reluctant,      1024,  0,2e9,0,0,1, "reluctant doubling period") \
 OPTION( reluctantmax,1048576,  0,2e9,0,0,1, "reluctant doubling period") \
 OPTION( rephase,           1,  0,  1,0,0,1, "enable resetting phase") \
@@ -168,6 +180,7 @@ OPTION( subsumemaxeff,   1e8,  0,2e9,1,0,1, "maximum subsuming efficiency") \
 OPTION( subsumemineff,   1e6,  0,2e9,1,0,1, "minimum subsuming efficiency") \
 OPTION( subsumeocclim,   1e2,  0,2e9,1,0,1, "watch list length limit") \
 OPTION( subsumereleff,   1e3,  1,1e5,1,0,1, "relative efficiency per mille") \
+OPTION( subsumesigs,       1,  0,  1,0,0,1, "clause signatures prefilter") \
 OPTION( subsumestr,        1,  0,  1,0,0,1, "strengthen during subsume") \
 OPTION( target,            1,  0,  2,0,0,1, "target phases (1=stable only)") \
 OPTION( terminateint,     10,  0,1e4,0,0,1, "termination check interval") \
@@ -179,6 +192,7 @@ OPTION( ternaryocclim,   1e2,  1,2e9,2,0,1, "ternary occurrence limit") \
 OPTION( ternaryreleff,    10,  1,1e5,1,0,1, "relative efficiency per mille") \
 OPTION( ternaryrounds,     2,  1, 16,1,0,1, "maximum ternary rounds") \
 OPTION( transred,          1,  0,  1,0,1,1, "transitive reduction of BIG") \
+OPTION( transredbits,      0,  0,  1,0,0,1, "bit-parallel reachability") \
 OPTION( transredmaxeff,  1e8,  0,2e9,1,0,1, "maximum efficiency") \
 OPTION( transredmineff,  1e6,  0,2e9,1,0,1, "minimum efficiency") \
 OPTION( transredreleff,  1e2,  1,1e5,1,0,1, "relative efficiency per mille") \
@@ -11,6 +11,11 @@ namespace CaDiCaL {
 // the next time 'probe' is called.  Left over probes from the last attempt
 // and new probes are tried until the limit is hit or all are tried.
 
+// At-most-one constraints encoded with binary clauses are not extracted
+// from the binary implication graph.  Without native propagation of such
+// constraints, with its own watches, conflict analysis and proof support,
+// detecting them would only feed statistics.
+
 /*------------------------------------------------------------------------*/
 
 bool Internal::probing () {
@@ -307,7 +312,7 @@ inline void Internal::probe_assign (int lit, int parent) {
   if (!level)
     learn_unit_clause (lit);
   else
-    assert (level == 1);
+    assert (level <= 2); // Level two only for tree probing.
   const signed char tmp = sign (lit);
   set_val (idx, tmp);
   assert (val (lit) > 0);
@@ -332,7 +337,7 @@ inline void Internal::probe_assign (int lit, int parent) {
 
 void Internal::probe_assign_decision (int lit) {
   require_mode (PROBE);
-  assert (!level);
+  assert (level <= 1);
   assert (propagated == trail.size ());
   level++;
   control.push_back (Level (lit, trail.size ()));
@@ -468,6 +473,11 @@ bool Internal::probe_propagate () {
               assert (!probe_reason);
               int dom = hyper_binary_resolve (w.clause);
               probe_assign (other, dom);
+            } else if (level) {
+              assert (level == 2);
+              assert (!probe_reason);
+              probe_reason = w.clause;
+              probe_assign (other, 0);
             } else {
               assert (lrat_chain.empty ());
               assert (!probe_reason);
@@ -672,6 +682,9 @@ void Internal::generate_probes () {
   reset_noccs ();
   shrink_vector (probes);
 
+  if (opts.probetree)
+    probe_tree_schedule ();
+
   PHASE ("probe-round", stats.probingrounds,
          "scheduled %zd literals %.0f%%", probes.size (),
          percent (probes.size (), 2u * max_var));
@@ -722,6 +735,9 @@ void Internal::flush_probes () {
   reset_noccs ();
   shrink_vector (probes);
 
+  if (opts.probetree)
+    probe_tree_schedule ();
+
   PHASE ("probe-round", stats.probingrounds,
          "flushed %zd literals %.0f%% remaining %zd", flushed,
          percent (flushed, remain + flushed), remain);
@@ -736,6 +752,8 @@ int Internal::next_probe () {
     if (probes.empty ()) {
       if (generated++)
         return 0;
+      if (level) // Shared prefix of tree probing.
+        backtrack ();
       generate_probes ();
     }
 
@@ -765,6 +783,121 @@ int Internal::next_probe () {
   }
 }
 
+/*------------------------------------------------------------------------*/
+
+// Tree based probing shares the propagation of a common binary implied
+// literal among probes.  Each probe has such a 'child' (probes are roots
+// in the binary implication graph with at least one binary clause in
+// which they occur negated).  Probes are scheduled such that probes with
+// the same child are consecutive.  The child is then propagated once as
+// decision on level one (thus also probed and with hyper binary
+// resolution) and then each of these probes is propagated on level two
+// followed by backtracking to level one.  Since the probe implies the
+// child, propagating both gives exactly the same result as propagating
+// the probe alone.  Thus the probe is not a failed literal if there is no
+// conflict on level two.  Otherwise we backtrack to the root level and
+// probe it again on level one to learn the unit through the usual failed
+// literal analysis.  Conflicts are rare, so this costs little.  However,
+// there is no hyper binary resolution for literals implied on level two.
+
+int Internal::probe_tree_child (int probe) {
+  for (const auto &w : watches (-probe)) {
+    if (!w.binary ())
+      continue;
+    if (w.clause->garbage)
+      continue;
+    const int child = w.blit;
+    if (active (child))
+      return child;
+  }
+  return 0;
+}
+
+void Internal::probe_tree_schedule () {
+
+  // Probes are taken from the back of the 'probes' stack.  Groups of
+  // probes with the same child are ordered by their first probe and
+  // within a group the order is kept.
+  //
+  const size_t size = probes.size ();
+  vector<unsigned> group (2 * (size_t) vsize, 0);
+  vector<uint64_t> keys;
+  keys.reserve (size);
+  unsigned groups = 0;
+  for (size_t i = 0; i < size; i++) {
+    const size_t pos = size - 1 - i;
+    const int child = probe_tree_child (probes[pos]);
+    unsigned g;
+    if (child) {
+      unsigned &tmp = group[vlit (child)];
+      if (!tmp)
+        tmp = ++groups;
+      g = tmp;
+    } else
+      g = ++groups;
+    keys.push_back (((uint64_t) g << 32) + i);
+  }
+  sort (keys.begin (), keys.end ());
+  vector<int> scheduled (size);
+  for (size_t i = 0; i < size; i++) {
+    const size_t pos = size - 1 - (uint32_t) keys[i];
+    scheduled[size - 1 - i] = probes[pos];
+  }
+  probes.swap (scheduled);
+
+  PHASE ("probe-round", stats.probingrounds,
+         "scheduled %zd probes in %u trees", size, groups);
+}
+
+// Returns 'true' if the probe has been dealt with and otherwise the caller
+// has to probe it on level one.  The shared child stays assigned if the
+// probe is not failed.
+
+bool Internal::probe_tree (int probe) {
+
+  const int child = probe_tree_child (probe);
+  if (level) {
+    assert (level == 1);
+    if (!child || control[1].decision != child)
+      backtrack ();
+  }
+  if (!child)
+    return false;
+
+  if (level)
+    stats.probetree++; // Reusing propagation of the shared child.
+  else {
+    LOG ("probing tree child %d of %d", child, probe);
+    probe_assign_decision (child);
+    if (!probe_propagate ()) {
+      failed_literal (child);
+      return unsat || val (probe);
+    }
+  }
+
+  assert (level == 1);
+  const signed char tmp = val (probe);
+  if (tmp > 0) // Child implies probe too.
+    return true;
+  if (tmp < 0) { // Child implies negation of probe.
+    backtrack ();
+    return false;
+  }
+
+  probe_assign_decision (probe);
+  if (probe_propagate ()) {
+    backtrack (1);
+    return true;
+  }
+
+  LOG (conflict, "tree probing conflict on level two");
+  conflict = 0;
+  backtrack ();
+  return false;
+}
+
+/*------------------------------------------------------------------------*/
+
 bool Internal::probe_round () {
 
   if (unsat)
@@ -819,6 +952,13 @@ bool Internal::probe_round () {
          stats.propagations.probe < limit && (probe = next_probe ())) {
     stats.probed++;
     LOG ("probing %d", probe);
+    if (opts.probetree) {
+      const bool probed = probe_tree (probe);
+      clean_probehbr_lrat ();
+      if (probed)
+        continue;
+    }
+    assert (!level);
     probe_assign_decision (probe);
     if (probe_propagate ())
       backtrack ();
@@ -827,6 +967,9 @@ bool Internal::probe_round () {
     clean_probehbr_lrat ();
   }
 
+  if (level)
+    backtrack ();
+
   if (unsat)
     LOG ("probing derived empty clause");
   else if (propagated < trail.size ()) {
@@ -884,9 +1027,11 @@ void CaDiCaL::Internal::probe (bool update_limits) {
     decompose (); // then start another round of ELS.
 
   // Remove duplicated binary clauses and perform in essence hyper unary
-  // resolution, i.e., derive the unit '2' from '1 2' and '-1 2'.
+  // resolution, i.e., derive the unit '2' from '1 2' and '-1 2'.  Then
+  // remove duplicated larger clauses too.
   //
   mark_duplicated_binary_clauses_as_garbage ();
+  mark_duplicated_clauses_as_garbage ();
 
   for (int round = 1; round <= opts.proberounds; round++)
     if (!probe_round ())
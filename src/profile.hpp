@@ -44,6 +44,7 @@ struct Internal;
   PROFILE (bump, 4) \
   PROFILE (checking, 2) \
   PROFILE (cdcl, 1) \
+  PROFILE (clone, 3) \
   PROFILE (collect, 3) \
   PROFILE (compact, 3) \
   PROFILE (condition, 2) \
@@ -64,7 +65,9 @@ struct Internal;
   PROFILE (probe, 2) \
   PROFILE (deduplicate, 3) \
   PROFILE (propagate, 4) \
+  PROFILE (recycle, 3) \
   PROFILE (reduce, 3) \
+  PROFILE (release, 3) \
   PROFILE (restart, 3) \
   PROFILE (restore, 2) \
   PROFILE (search, 1) \
@@ -236,6 +236,17 @@ bool Internal::propagate () {
   //
   int64_t before = propagated;
 
+#ifdef CACHESTATS
+  // Count the cache lines of clauses dereferenced during propagation,
+  // where consecutive accesses to the same line are counted only once.
+  // This allows to compare different arena orderings ('opts.arenatype')
+  // but is only compiled in with '-DCACHESTATS' to keep the hot-spot of
+  // the solver below as lean as possible.
+  //
+  int64_t touched = 0;
+  uintptr_t line = 0;
+#endif
+
   while (!conflict && propagated != trail.size ()) {
 
     const int lit = -trail[propagated++];
@@ -297,6 +308,12 @@ bool Internal::propagate () {
         if (conflict)
           break; // Stop if there was a binary conflict already.
 
+#ifdef CACHESTATS
+        const uintptr_t clause_line = (uintptr_t) w.clause >> 6;
+        touched += (clause_line != line);
+        line = clause_line;
+#endif
+
         // The cache line with the clause data is forced to be loaded here
         // and thus this first memory access below is the real hot-spot of
         // the solver.  Note, that this check is positive very rarely and
@@ -459,6 +476,9 @@ bool Internal::propagate () {
     // Avoid updating stats eagerly in the hot-spot of the solver.
     //
     stats.propagations.search += propagated - before;
+#ifdef CACHESTATS
+    stats.touched += touched;
+#endif
 
     if (!conflict)
       no_conflict_until = propagated;
@@ -3,9 +3,9 @@
 namespace CaDiCaL {
 
 // Slightly different than 'bump_variable' since the variable is not
-// enqueued at all.
+// enqueued at all.  Also used for reusing recycled variables.
 
-inline void Internal::init_enqueue (int idx) {
+void Internal::init_enqueue (int idx) {
   Link &l = links[idx];
   if (opts.reverse) {
     l.prev = 0;
@@ -0,0 +1,269 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Recycling inactive internal variables is a cheap alternative to the full
+// renumbering of all variables, clauses and watches in 'compact'.  In long
+// incremental sessions many variables are retired (fixed, eliminated,
+// substituted or pure), for instance activation literals which are melted
+// and then eliminated, while new external variables are constantly added.
+
+// Instead of compacting, the internal indices of retired variables are
+// disconnected from their external variable (exactly as 'compact' does it)
+// and reset to the state of a freshly initialized but still unused
+// variable.  They are then kept in 'reusable' and are handed out again in
+// 'External::init' and 'External::internalize' before new internal
+// variables are allocated.  Thus 'max_var' stays bounded by the maximum
+// number of simultaneously active variables and 'compact' becomes rare.
+
+// As in 'compact' all external literals of fixed variables are mapped to a
+// single fixed internal variable, the 'fixed_anchor', which is never
+// recycled itself.
+
+/*------------------------------------------------------------------------*/
+
+bool Internal::recycling () {
+  if (level)
+    return false;
+  if (!opts.recycle)
+    return false;
+  if (stats.conflicts < lim.recycle)
+    return false;
+  if (external_prop)
+    return false;
+  return retired.size () >= (size_t) opts.recyclemin;
+}
+
+// Remember variables which just became inactive as recycling candidates.
+// They are checked again during recycling since they might have been
+// reactivated in the meantime (during 'restore').
+
+void Internal::mark_retired (int idx) {
+  if (!opts.recycle)
+    return;
+  LOG ("marking %d as retired variable", idx);
+  retired.push_back (idx);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Return whether the given retired variable can be recycled and if so,
+// disconnect it from its external variable.
+
+bool Internal::disconnect_retired_variable (int idx) {
+
+  const Flags &f = flags (idx);
+  if (f.unused () || f.active ())
+    return false;
+  if (idx == fixed_anchor)
+    return false;
+  if (frozentab[idx] || relevanttab[idx])
+    return false;
+
+  const int eidx = i2e[idx];
+  if (!eidx || abs (external->e2i[eidx]) != idx)
+    return false;
+
+  if (f.fixed ()) {
+
+    // Keep unit clause identifiers for LRAT (see also 'compact').  This is
+    // also necessary for the anchor since falsified literals of other
+    // external variables mapped to it are justified by their own units.
+    //
+    uint64_t &id1 = external->ext_units[2 * eidx];
+    uint64_t &id2 = external->ext_units[2 * eidx + 1];
+    assert (!id1 || !id2);
+    if (!id1 && !id2) {
+      id1 = unit_clauses[2 * idx];
+      id2 = unit_clauses[2 * idx + 1];
+    }
+
+    if (!fixed_anchor) {
+      LOG ("using fixed variable %d as anchor", idx);
+      fixed_anchor = idx;
+      return false;
+    }
+
+    const int anchor = val (idx) == val (fixed_anchor) ? fixed_anchor
+                                                       : -fixed_anchor;
+    LOG ("recycling fixed %d maps external %d to internal %d", idx, eidx,
+         anchor);
+    external->e2i[eidx] = anchor;
+
+  } else {
+    LOG ("recycling inactive %d unmaps external %d", idx, eidx);
+    external->e2i[eidx] = 0;
+  }
+
+  return true;
+}
+
+// Reset the internal data of a disconnected variable to that of a freshly
+// initialized unused variable (see 'enlarge' and 'init_vars').
+
+void Internal::reset_recycled_variable (int idx) {
+
+  Flags &f = flags (idx);
+  switch (f.status) {
+  case Flags::FIXED:
+    assert (stats.now.fixed > 0);
+    stats.now.fixed--;
+    break;
+  case Flags::ELIMINATED:
+    assert (stats.now.eliminated > 0);
+    stats.now.eliminated--;
+    break;
+  case Flags::SUBSTITUTED:
+    assert (stats.now.substituted > 0);
+    stats.now.substituted--;
+    break;
+  default:
+    assert (f.status == Flags::PURE);
+    assert (stats.now.pure > 0);
+    stats.now.pure--;
+    break;
+  }
+  stats.unused++;
+  f = Flags ();
+  assert (f.unused ());
+  stats.mark.subsume++; // see 'init_vars'
+  stats.mark.block += 2;
+
+  if (phases.target[idx] && target_assigned)
+    target_assigned--;
+  if (phases.best[idx] && best_assigned)
+    best_assigned--;
+
+  set_val (idx, 0);
+  vtab[idx].level = 0;
+  vtab[idx].trail = 0;
+  vtab[idx].reason = 0;
+  i2e[idx] = 0;
+  marks[idx] = 0;
+  parents[idx] = 0;
+  gtab[idx] = 0;
+  phases.saved[idx] = opts.phase ? 1 : -1;
+  phases.forced[idx] = 0;
+  phases.target[idx] = 0;
+  phases.best[idx] = 0;
+  phases.prev[idx] = 0;
+  phases.min[idx] = 0;
+  unit_clauses[2 * idx] = unit_clauses[2 * idx + 1] = 0;
+  ptab[2 * idx] = ptab[2 * idx + 1] = -1;
+
+  for (int lit : {idx, -idx}) {
+    assert (watches (lit).empty ());
+    erase_vector (watches (lit));
+  }
+
+  // Unassigned recycled root level units have to become decision
+  // candidates again, exactly as in 'unassign' during backtracking.
+  //
+  if (!scores.contains (idx))
+    scores.push_back (idx);
+  if (queue.bumped < btab[idx])
+    update_queue_unassigned (idx);
+
+  stats.recycled++;
+}
+
+/*------------------------------------------------------------------------*/
+
+void Internal::recycle () {
+
+  assert (!level);
+  assert (!unsat);
+  assert (!conflict);
+  assert (propagated == trail.size ());
+  assert (trail.size () == num_assigned);
+
+  START (recycle);
+  stats.recycles++;
+
+  // After garbage collection no clause contains any inactive variable
+  // anymore (the same invariant is used in 'compact').
+  //
+  garbage_collection ();
+
+  size_t recycled = 0, recycled_fixed = 0;
+  for (const auto idx : retired) {
+    if (!disconnect_retired_variable (idx))
+      continue;
+    if (flags (idx).fixed ())
+      recycled_fixed++;
+    reset_recycled_variable (idx);
+    reusable.push_back (idx);
+    recycled++;
+  }
+  erase_vector (retired);
+
+  // Flush recycled root level units from the trail.
+  //
+  if (recycled_fixed) {
+    const auto end = trail.end ();
+    auto j = trail.begin (), i = j;
+    while (i != end) {
+      const int lit = *i++;
+      if (!val (lit))
+        continue;
+      var (lit).trail = j - trail.begin ();
+      *j++ = lit;
+    }
+    trail.resize (j - trail.begin ());
+    propagated = propagated2 = num_assigned = trail.size ();
+    no_conflict_until = 0;
+    notified = 0;
+  }
+
+  if (!probes.empty ()) {
+    const auto end = probes.end ();
+    auto j = probes.begin (), i = j;
+    while (i != end) {
+      const int probe = *i++;
+      if (active (probe))
+        *j++ = probe;
+    }
+    probes.resize (j - probes.begin ());
+  }
+
+  check_var_stats ();
+
+  lim.recycle = stats.conflicts + opts.recycleint;
+
+  PHASE ("recycle", stats.recycles,
+         "recycled %zd variables (%zd fixed) now %zd reusable", recycled,
+         recycled_fixed, reusable.size ());
+
+  STOP (recycle);
+  report ('&', !opts.reportall && !recycled);
+}
+
+/*------------------------------------------------------------------------*/
+
+// Hand out a recycled variable index for a new external variable.  The
+// variable is moved to the end of the decision queue and (re)inserted into
+// the score heap as if it had just been initialized.  Returns zero if there
+// is no recycled variable left.
+
+int Internal::reuse_recycled_variable () {
+  if (reusable.empty ())
+    return 0;
+  if (level && !external_prop)
+    backtrack ();
+  const int idx = reusable.back ();
+  reusable.pop_back ();
+  assert (flags (idx).unused ());
+  assert (!val (idx));
+  queue.dequeue (links, idx);
+  init_enqueue (idx);
+  update_queue_unassigned (queue.last);
+  if (!scores.contains (idx))
+    scores.push_back (idx);
+  stats.reusedvars++;
+  LOG ("reusing recycled variable %d", idx);
+  return idx;
+}
+
+} // namespace CaDiCaL
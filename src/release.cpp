@@ -0,0 +1,146 @@
+#include "internal.hpp"
+
+namespace CaDiCaL {
+
+/*------------------------------------------------------------------------*/
+
+// Many tables and scratch vectors grow to their peak size during variable
+// elimination, subsumption, probing and conflict analysis and then keep
+// that capacity for the rest of the run.  For long-lived solver instances
+// (for instance in incremental usage) this memory is never given back.
+// This function releases it explicitly.  It can be called through
+// 'Solver::release_memory', after preprocessing and, with 'release=2',
+// after every 'solve' call.
+
+/*------------------------------------------------------------------------*/
+
+// Shrink the capacity of the given vector to its size and return the
+// number of bytes released.
+
+template <class T> static size_t release_vector (vector<T> &v) {
+  const size_t res = (v.capacity () - v.size ()) * sizeof (T);
+  if (res)
+    shrink_vector (v);
+  return res;
+}
+
+// Watch lists are only shrunken if their slack is large, since otherwise
+// they would immediately be enlarged again during search.
+
+size_t Internal::release_watches () {
+  size_t res = 0;
+  if (!watching ())
+    return res;
+  const double factor = 1 + opts.releaseslack / 100.0;
+  for (auto lit : lits) {
+    Watches &ws = watches (lit);
+    if (ws.capacity () <= factor * ws.size ())
+      continue;
+    res += release_vector (ws);
+  }
+  return res;
+}
+
+// The scratch vectors are all empty outside of the procedures using them,
+// but keep their peak capacity.
+
+size_t Internal::release_scratch_vectors () {
+  size_t res = 0;
+  res += release_vector (clause);
+  res += release_vector (levels);
+  res += release_vector (analyzed);
+  res += release_vector (unit_analyzed);
+  res += release_vector (minimized);
+  res += release_vector (shrinkable);
+  res += release_vector (decomposed);
+  res += release_vector (original);
+  res += release_vector (lrat_chain);
+  res += release_vector (mini_chain);
+  res += release_vector (minimize_chain);
+  res += release_vector (unit_chain);
+  res += release_vector (probes);
+  res += release_vector (retired);
+  res += release_vector (reusable);
+  return res;
+}
+
+// Some persistent tables keep their capacity too.  The eager subsumption
+// index is empty after garbage collection (see 'eager.hpp') and then
+// deallocated completely (it is initialized again on demand in
+// 'eagerly_subsume_indexed_learned_clauses').  Otherwise only its stale
+// bucket positions are flushed.  The duplicated clause table is rebuilt
+// during garbage collection anyhow, but not the stack of new clauses.
+// Finally cached gate clauses of inactive variables are never used again.
+
+size_t Internal::release_persistent_tables () {
+  size_t res = 0;
+  const uint64_t lower = eager.lower ();
+  if (lower == eager.added) {
+    res += eager.clauses.capacity () * sizeof (Clause *);
+    res += eager.signatures.capacity () * sizeof (uint64_t);
+    res += eager.buckets.capacity () * sizeof (vector<uint64_t>);
+    for (const auto &bucket : eager.buckets)
+      res += bucket.capacity () * sizeof (uint64_t);
+    eager = EagerIndex ();
+  } else
+    for (auto &bucket : eager.buckets) {
+      const auto end = bucket.end ();
+      auto j = bucket.begin ();
+      for (auto i = j; i != end; i++)
+        if (*i >= lower)
+          *j++ = *i;
+      bucket.resize (j - bucket.begin ());
+      res += release_vector (bucket);
+    }
+  res += release_vector (duplicates.added);
+  for (size_t idx = 1; idx < gatetab.size (); idx++) {
+    GateClauses &cached = gatetab[idx];
+    if (active (idx))
+      res += release_vector (cached);
+    else {
+      res += cached.capacity () * sizeof (GateClause);
+      erase_vector (cached);
+    }
+  }
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+void Internal::release_memory () {
+
+  if (unsat)
+    return;
+
+  assert (clause.empty ());
+  assert (analyzed.empty ());
+  assert (minimized.empty ());
+  assert (shrinkable.empty ());
+  assert (!occurring ());
+
+  START (release);
+  stats.releases++;
+
+  // Garbage collection flushes deleted and satisfied clauses.  Then the
+  // arena (if used) is copied into a 'to' space of exactly the needed size
+  // and the old 'from' space (with all the garbage) is deallocated.  This
+  // is only done at the root level, since we do not want to backtrack
+  // (and thus lose a satisfying assignment) here, and only if all root
+  // level units have been propagated, since otherwise clauses with
+  // falsified literals might still be watched by those literals.
+  //
+  if (!level && propagated == trail.size () && stats.garbage.bytes)
+    garbage_collection ();
+
+  size_t released = release_scratch_vectors ();
+  released += release_persistent_tables ();
+  released += release_watches ();
+  stats.released += released;
+
+  PHASE ("release", stats.releases, "released %zd bytes (%.0f MB)",
+         released, released / (double) (1l << 20));
+
+  STOP (release);
+}
+
+} // namespace CaDiCaL
@@ -25,6 +25,7 @@ b  blocked clause elimination
 G  before garbage collection
 C  after garbage collection
 /  compacted internal literals and remapped external to internal
+&  recycled inactive internal variables for reuse
 c  covered clause elimination
 d  decomposed binary implication graph and substituted equivalent literals
 2  removed duplicated binary clauses
@@ -242,6 +243,7 @@ void Internal::report (char type, int verbose) {
   case '-':
     tout.normal ();
     break;
+  case '&':
   case '/':
     tout.yellow (true);
     break;
@@ -410,6 +410,13 @@ void Solver::reserve (int min_max_var) {
   LOG_API_CALL_END ("reserve", min_max_var);
 }
 
+void Solver::release_memory () {
+  TRACE ("release_memory");
+  REQUIRE_VALID_STATE ();
+  internal->release_memory ();
+  LOG_API_CALL_END ("release_memory");
+}
+
 /*------------------------------------------------------------------------*/
 #ifndef NTRACING
 
@@ -1568,6 +1575,19 @@ void Solver::copy (Solver &other) const {
   external->copy_flags (*other.external);
 }
 
+void Solver::clone (Solver &other) {
+  LOG_API_CALL_BEGIN ("clone");
+  REQUIRE_READY_STATE ();
+  REQUIRE (other.state () & CONFIGURING, "target solver already modified");
+  REQUIRE (!external->propagator,
+           "can not clone with connected external propagator");
+  REQUIRE (!internal->proof && !other.internal->proof,
+           "can not clone with proof tracing or checking");
+  external->clone (*other.external);
+  other._state = _state;
+  LOG_API_CALL_END ("clone");
+}
+
 /*------------------------------------------------------------------------*/
 
 void Solver::section (const char *title) {
@@ -82,6 +82,17 @@ void Stats::print (Internal *internal) {
   if (all)
     PRT ("compacts:        %15" PRId64 "   %10.2f    interval",
          stats.compacts, relative (stats.conflicts, stats.compacts));
+  if (all || stats.clones)
+    PRT ("clones:          %15" PRId64 "   %10.2f    interval",
+         stats.clones, relative (stats.conflicts, stats.clones));
+  if (all || stats.recycled) {
+    PRT ("recycled:        %15" PRId64 "   %10.2f %%  of all variables",
+         stats.recycled, percent (stats.recycled, stats.vars));
+    PRT ("  recycles:      %15" PRId64 "   %10.2f    interval",
+         stats.recycles, relative (stats.conflicts, stats.recycles));
+    PRT ("  reusedvars:    %15" PRId64 "   %10.2f %%  of recycled",
+         stats.reusedvars, percent (stats.reusedvars, stats.recycled));
+  }
   if (all || stats.conflicts) {
     PRT ("conflicts:       %15" PRId64 "   %10.2f    per second",
          stats.conflicts, relative (stats.conflicts, t));
@@ -98,6 +109,13 @@ void Stats::print (Internal *internal) {
          relative (stats.conflicts, stats.conditionings));
     PRT ("  condcands:     %15" PRId64 "   %10.2f    candidate clauses",
          stats.condcands, relative (stats.condcands, stats.conditionings));
+    PRT ("  condfiltered:  %15" PRId64 "   %10.2f %%  of candidates",
+         stats.condfiltered,
+         percent (stats.condfiltered,
+                  stats.condcands + stats.condfiltered));
+    PRT ("  conddelayed:   %15" PRId64 "   %10.2f %%  of conditionings",
+         stats.conddelayed,
+         percent (stats.conddelayed, stats.conditionings));
     PRT ("  condassinit:   %17.1f  %9.2f %%  initial assigned",
          relative (stats.condassinit, stats.conditionings),
          percent (stats.condassinit, stats.condassvars));
@@ -132,6 +150,9 @@ void Stats::print (Internal *internal) {
     PRT ("  blocked:       %15" PRId64 "   %10.2f %%  of covered clauses",
          stats.cover.blocked,
          percent (stats.cover.blocked, stats.cover.total));
+    PRT ("  coverreused:   %15" PRId64 "   %10.2f    per covering",
+         stats.cover.reused,
+         relative (stats.cover.reused, stats.cover.count));
   }
   if (all || stats.decisions) {
     PRT ("decisions:       %15" PRId64 "   %10.2f    per second",
@@ -150,6 +171,9 @@ void Stats::print (Internal *internal) {
          stats.elimtried, percent (stats.all.eliminated, stats.elimtried));
     PRT ("  elimgates:     %15" PRId64 "   %10.2f %%  gates per tried",
          stats.elimgates, percent (stats.elimgates, stats.elimtried));
+    PRT ("  elimcached:    %15" PRId64 "   %10.2f %%  gates reused",
+         stats.elimcached,
+         percent (stats.elimcached, stats.elimgates + stats.elimcached));
     PRT ("  elimequivs:    %15" PRId64 "   %10.2f %%  equivalence gates",
          stats.elimequivs, percent (stats.elimequivs, stats.elimgates));
     PRT ("  elimands:      %15" PRId64 "   %10.2f %%  and gates",
@@ -216,6 +240,8 @@ void Stats::print (Internal *internal) {
          stats.probed, relative (stats.probed, stats.failed));
     PRT ("  hbrs:          %15" PRId64 "   %10.2f    per probed",
          stats.hbrs, relative (stats.hbrs, stats.probed));
+    PRT ("  probetree:     %15" PRId64 "   %10.2f %%  per probed",
+         stats.probetree, percent (stats.probetree, stats.probed));
     PRT ("  hbrsizes:      %15" PRId64 "   %10.2f    per hbr",
          stats.hbrsizes, relative (stats.hbrsizes, stats.hbrs));
     PRT ("  hbreds:        %15" PRId64 "   %10.2f %%  per hbr",
@@ -241,6 +267,9 @@ void Stats::print (Internal *internal) {
          stats.instantiated, percent (stats.instantiated, stats.instried));
     PRT ("  instrounds:    %15" PRId64 "   %10.2f %%  of elimrounds",
          stats.instrounds, percent (stats.instrounds, stats.elimrounds));
+    PRT ("  instbatches:   %15" PRId64 "   %10.2f    per round",
+         stats.instbatches,
+         relative (stats.instbatches, stats.instrounds));
   }
   if (all || stats.conflicts) {
     PRT ("learned:         %15" PRId64 "   %10.2f %%  per conflict",
@@ -326,6 +355,10 @@ void Stats::print (Internal *internal) {
   PRT ("  searchprops:   %15" PRId64 "   %10.2f %%  of propagations",
        stats.propagations.search,
        percent (stats.propagations.search, propagations));
+#ifdef CACHESTATS
+  PRT ("  touched:       %15" PRId64 "   %10.2f    per search propagation",
+       stats.touched, relative (stats.touched, stats.propagations.search));
+#endif
   PRT ("  transredprops: %15" PRId64 "   %10.2f %%  of propagations",
        stats.propagations.transred,
        percent (stats.propagations.transred, propagations));
@@ -346,6 +379,12 @@ void Stats::print (Internal *internal) {
          stats.reductions, relative (stats.conflicts, stats.reductions));
     PRT ("  collections:   %15" PRId64 "   %10.2f    interval",
          stats.collections, relative (stats.conflicts, stats.collections));
+    PRT ("  pending:       %15" PRId64 "", stats.pending);
+  }
+  if (all || stats.releases) {
+    PRT ("releases:        %15" PRId64 "   %10.2f    MB per release",
+         stats.releases,
+         relative (stats.released / (double) (1l << 20), stats.releases));
   }
   if (all || stats.rephased.total) {
     PRT ("rephased:        %15" PRId64 "   %10.2f    interval",
@@ -420,6 +459,8 @@ void Stats::print (Internal *internal) {
          relative (stats.subsumerounds, stats.subsumephases));
     PRT ("  deduplicated:  %15" PRId64 "   %10.2f %%  per subsumed",
          stats.deduplicated, percent (stats.deduplicated, stats.subsumed));
+    PRT ("  deduplong:     %15" PRId64 "   %10.2f %%  per deduplicated",
+         stats.deduplong, percent (stats.deduplong, stats.deduplicated));
     PRT ("  transreds:     %15" PRId64 "   %10.2f    interval",
          stats.transreds, relative (stats.conflicts, stats.transreds));
     PRT ("  transitive:    %15" PRId64 "   %10.2f %%  per subsumed",
@@ -434,6 +475,9 @@ void Stats::print (Internal *internal) {
          stats.subchecks, relative (stats.subchecks, stats.subtried));
     PRT ("  subchecks2:    %15" PRId64 "   %10.2f %%  per subcheck",
          stats.subchecks2, percent (stats.subchecks2, stats.subchecks));
+    PRT ("  subsigs:       %15" PRId64 "   %10.2f %%  rejected checks",
+         stats.subsigs,
+         percent (stats.subsigs, stats.subsigs + stats.subchecks));
     PRT ("  elimotfsub:    %15" PRId64 "   %10.2f %%  of subsumed",
          stats.elimotfsub, percent (stats.elimotfsub, stats.subsumed));
     PRT ("  elimbwsub:     %15" PRId64 "   %10.2f %%  of subsumed",
@@ -26,6 +26,8 @@ struct Stats {
     int64_t walk;        // propagated during local search
   } propagations;
 
+  int64_t touched; // clause cache lines touched in 'propagate'
+
   struct {
     int64_t ext_cb;     // number of times any external callback was called
     int64_t eprop_call; // number of times external_propagate was called
@@ -52,6 +54,8 @@ struct Stats {
   int64_t condcands;    // globally blocked candidate clauses
   int64_t condcondinit; // initial literals in conditional part
   int64_t condcondrem; // remaining literals in conditional part for blocked
+  int64_t conddelayed; // rounds delayed due to high clause variable ratio
+  int64_t condfiltered; // candidates without initial autarky literal
   int64_t conditioned; // globally blocked clauses eliminated
   int64_t conditionings; // globally blocked clause eliminations
   int64_t condprops;     // propagated unassigned literals
@@ -77,6 +81,7 @@ struct Stats {
     int64_t count;      // number of covered clause elimination rounds
     int64_t asymmetric; // number of asymmetric tautologies in CCE
     int64_t blocked;    // number of blocked covered tautologies
+    int64_t reused;     // added literals kept from shared prefixes
     int64_t total;      // total number of eliminated clauses
   } cover;
 
@@ -115,6 +120,10 @@ struct Stats {
   } flush;
 
   int64_t compacts;      // number of compactifications
+  int64_t clones;        // number of cloned solvers
+  int64_t recycles;      // number of variable recycling rounds
+  int64_t recycled;      // number of recycled variables
+  int64_t reusedvars;    // number of reused recycled variables
   int64_t shuffled;      // shuffled queues and scores
   int64_t restarts;      // actual number of happened restarts
   int64_t restartlevels; // levels at restart
@@ -139,15 +148,20 @@ struct Stats {
   int64_t reduced;        // number of reduced clauses
   int64_t collected;      // number of collected bytes
   int64_t collections;    // number of garbage collections
+  int64_t pending;        // flushed watch lists of pending literals
+  int64_t releases;       // number of memory releases
+  int64_t released;       // number of released bytes
   int64_t hbrs;           // hyper binary resolvents
   int64_t hbrsizes;       // sum of hyper resolved base clauses
   int64_t hbreds;         // redundant hyper binary resolvents
   int64_t hbrsubs;        // subsuming hyper binary resolvents
+  int64_t instbatches;    // number of batched instantiations
   int64_t instried;       // number of tried instantiations
   int64_t instantiated;   // number of successful instantiations
   int64_t instrounds;     // number of instantiation rounds
   int64_t subsumed;       // number of subsumed clauses
-  int64_t deduplicated;   // number of removed duplicated binary clauses
+  int64_t deduplicated;   // number of removed duplicated clauses
+  int64_t deduplong;      // number of removed duplicated long clauses
   int64_t deduplications; // number of deduplication phases
   int64_t strengthened;   // number of strengthened clauses
   int64_t
@@ -157,6 +171,7 @@ struct Stats {
   int64_t subtried;  // number of tried subsumptions
   int64_t subchecks; // number of pair-wise subsumption checks
   int64_t subchecks2;    // same but restricted to binary clauses
+  int64_t subsigs;       // checks rejected by clause signatures
   int64_t elimotfsub;    // number of on-the-fly subsumed during elimination
   int64_t subsumerounds; // number of subsumption rounds
   int64_t subsumephases; // number of scheduled subsumption phases
@@ -170,6 +185,7 @@ struct Stats {
   int64_t elimtried;      // number of variable elimination attempts
   int64_t elimsubst;      // number of eliminations through substitutions
   int64_t elimgates;      // number of gates found during elimination
+  int64_t elimcached;     // number of gates reused from the gate cache
   int64_t elimequivs;     // number of equivalences found during elimination
   int64_t elimands;       // number of AND gates found during elimination
   int64_t elimites;       // number of ITE gates found during elimination
@@ -220,6 +236,7 @@ struct Stats {
   int64_t failed;        // number of failed literals
   int64_t hyperunary;    // hyper unary resolved unit clauses
   int64_t probefailed;   // failed literals from probing
+  int64_t probetree;     // probes propagated on shared tree prefix
   int64_t transredunits; // units derived in transitive reduction
   int64_t blockings;     // number of blocked clause eliminations
   int64_t blocked;       // number of actually blocked clauses
@@ -142,6 +142,25 @@ inline int Internal::subsume_check (Clause *subsuming, Clause *subsumed) {
 
 /*------------------------------------------------------------------------*/
 
+// Each connected clause gets a 64-bit signature (a Bloom filter) of its
+// variables, which is stored in 'sigs' in parallel to the occurrence list
+// it is connected to.  A clause can only subsume or strengthen another
+// clause if all its variables occur in the other clause.  Thus if the
+// signature of a connected clause has a bit set which is not set in the
+// signature of the candidate, then the connected clause can be skipped
+// without calling 'subsume_check' and accessing its literals at all.  We
+// use variables instead of literals since strengthening allows one literal
+// to occur negated.
+
+static inline uint64_t subsume_signature (const Clause *c) {
+  uint64_t res = 0;
+  for (const auto &lit : *c)
+    res |= (uint64_t) 1 << (abs (lit) & 63);
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
 // Candidate clause 'subsumed' is subsumed by 'subsuming'.
 
 inline void Internal::subsume_clause (Clause *subsuming, Clause *subsumed) {
@@ -208,7 +227,8 @@ void Internal::strengthen_clause (Clause *c, int lit) {
 // can not be subsumed nor strengthened and zero is returned.
 
 inline int Internal::try_to_subsume_clause (Clause *c,
-                                            vector<Clause *> &shrunken) {
+                                            vector<Clause *> &shrunken,
+                                            const vector<Sigs> &sigs) {
 
   stats.subtried++;
   assert (!level);
@@ -216,6 +236,9 @@ inline int Internal::try_to_subsume_clause (Clause *c,
 
   mark (c); // signed!
 
+  const bool signatures = !sigs.empty ();
+  const uint64_t signature = signatures ? subsume_signature (c) : 0;
+
   Clause dummy; // Communicate binary subsuming clause.
 
   Clause *d = 0;
@@ -283,10 +306,17 @@ inline int Internal::try_to_subsume_clause (Clause *c,
       // code after the loop is used.
       //
       const Occs &os = occs (sign * lit);
-      for (const auto &e : os) {
+      const Sigs *ss = signatures ? &sigs[vlit (sign * lit)] : 0;
+      assert (!ss || ss->size () == os.size ());
+      for (size_t i = 0; i < os.size (); i++) {
+        Clause *e = os[i];
         assert (!e->garbage); // sanity check
         if (e->garbage)
           continue; // defensive: not needed
+        if (ss && ((*ss)[i] & ~signature)) {
+          stats.subsigs++;
+          continue;
+        }
         flipped = subsume_check (e, c);
         if (!flipped)
           continue;
@@ -383,6 +413,15 @@ bool Internal::subsume_round () {
   if (!stats.current.redundant && !stats.current.irredundant)
     return false;
 
+  // After a completed round all 'subsume' flags are reset.  Thus if no
+  // variable has been marked since then, no clause can be scheduled and
+  // we can avoid traversing all clauses.
+  //
+  if (last.subsume.marked == stats.mark.subsume) {
+    LOG ("no new subsume candidate variables since last round");
+    return false;
+  }
+
   START_SIMPLIFIER (subsume, SUBSUME);
   stats.subsumerounds++;
 
@@ -492,6 +531,12 @@ bool Internal::subsume_round () {
   init_occs ();
   init_bins ();
 
+  // Signatures of connected clauses in parallel to 'otab'.
+  //
+  vector<Sigs> sigs;
+  if (opts.subsumesigs)
+    sigs.resize (2 * vsize);
+
   for (const auto &s : schedule) {
 
     if (terminated_asynchronously ())
@@ -514,7 +559,7 @@ bool Internal::subsume_round () {
     //
     if (c->size > 2 && c->subsume) {
       c->subsume = false;
-      const int tmp = try_to_subsume_clause (c, shrunken);
+      const int tmp = try_to_subsume_clause (c, shrunken, sigs);
       if (tmp > 0) {
         subsumed++;
         continue;
@@ -569,6 +614,8 @@ bool Internal::subsume_round () {
            minlit, minsize, minoccs);
 
       occs (minlit).push_back (c);
+      if (!sigs.empty ())
+        sigs[vlit (minlit)].push_back (subsume_signature (c));
 
       // This sorting should give faster failures for assumption checks
       // since the less occurring variables are put first in a clause and
@@ -620,15 +667,19 @@ bool Internal::subsume_round () {
   // Release occurrence lists and schedule.
   //
   erase_vector (schedule);
+  erase_vector (sigs);
   reset_noccs ();
   reset_occs ();
   reset_bins ();
 
   // Reset all old 'added' flags and mark variables in shrunken
-  // clauses as 'added' for the next subsumption round.
+  // clauses as 'added' for the next subsumption round.  The marks of the
+  // latter have to count as new in the check at the start of the round.
   //
-  if (completed)
+  if (completed) {
     reset_subsume_bits ();
+    last.subsume.marked = stats.mark.subsume;
+  }
 
   for (const auto &c : shrunken)
     mark_added (c);
@@ -659,7 +710,12 @@ void Internal::subsume (bool update_limits) {
     return;
   }
 
-  if (opts.subsume) {
+  // Avoid tearing down and reconnecting all watches and propagating over
+  // the whole formula if 'subsume_round' would return immediately anyhow.
+  //
+  if (opts.subsume && last.subsume.marked == stats.mark.subsume)
+    LOG ("no new subsume candidate variables since last round");
+  else if (opts.subsume) {
     reset_watches ();
     subsume_round ();
     init_watches ();
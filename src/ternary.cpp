@@ -19,28 +19,27 @@ namespace CaDiCaL {
 
 /*------------------------------------------------------------------------*/
 
+// Binary and ternary clauses are kept in the hash set 'ternaries' while
+// hyper ternary resolution is running.  Thus checking whether a resolvent
+// already exists takes constant time, while scanning the occurrence lists
+// of high occurrence literals made hyper ternary resolution quadratic.
+
+void Internal::ternary_add_clause (Clause *c) {
+  assert (c->size == 2 || c->size == 3);
+  const int *lits = c->literals;
+  if (c->size == 2)
+    ternaries.insert (TernaryClause (lits[0], lits[1]));
+  else
+    ternaries.insert (TernaryClause (lits[0], lits[1], lits[2]));
+}
+
 // Check whether a binary clause consisting of the permutation of the given
 // literals already exists.
 
 bool Internal::ternary_find_binary_clause (int a, int b) {
-  assert (occurring ());
   assert (active (a));
   assert (active (b));
-  size_t s = occs (a).size ();
-  size_t t = occs (b).size ();
-  int lit = s < t ? a : b;
-  if (opts.ternaryocclim < (int) occs (lit).size ())
-    return true;
-  for (const auto &c : occs (lit)) {
-    if (c->size != 2)
-      continue;
-    const int *lits = c->literals;
-    if (lits[0] == a && lits[1] == b)
-      return true;
-    if (lits[0] == b && lits[1] == a)
-      return true;
-  }
-  return false;
+  return ternaries.contains (TernaryClause (a, b));
 }
 
 /*------------------------------------------------------------------------*/
@@ -49,52 +48,16 @@ bool Internal::ternary_find_binary_clause (int a, int b) {
 // literals already exists or is subsumed by an existing binary clause.
 
 bool Internal::ternary_find_ternary_clause (int a, int b, int c) {
-  assert (occurring ());
   assert (active (a));
   assert (active (b));
   assert (active (c));
-  size_t r = occs (a).size ();
-  size_t s = occs (b).size ();
-  size_t t = occs (c).size ();
-  int lit;
-  if (r < s)
-    lit = (t < r) ? c : a;
-  else
-    lit = (t < s) ? c : b;
-  if (opts.ternaryocclim < (int) occs (lit).size ())
+  if (ternary_find_binary_clause (a, b))
     return true;
-  for (const auto &d : occs (lit)) {
-    const int *lits = d->literals;
-    if (d->size == 2) {
-      if (lits[0] == a && lits[1] == b)
-        return true;
-      if (lits[0] == b && lits[1] == a)
-        return true;
-      if (lits[0] == a && lits[1] == c)
-        return true;
-      if (lits[0] == c && lits[1] == a)
-        return true;
-      if (lits[0] == b && lits[1] == c)
-        return true;
-      if (lits[0] == c && lits[1] == b)
-        return true;
-    } else {
-      assert (d->size == 3);
-      if (lits[0] == a && lits[1] == b && lits[2] == c)
-        return true;
-      if (lits[0] == a && lits[1] == c && lits[2] == b)
-        return true;
-      if (lits[0] == b && lits[1] == a && lits[2] == c)
-        return true;
-      if (lits[0] == b && lits[1] == c && lits[2] == a)
-        return true;
-      if (lits[0] == c && lits[1] == a && lits[2] == b)
-        return true;
-      if (lits[0] == c && lits[1] == b && lits[2] == a)
-        return true;
-    }
-  }
-  return false;
+  if (ternary_find_binary_clause (a, c))
+    return true;
+  if (ternary_find_binary_clause (b, c))
+    return true;
+  return ternaries.contains (TernaryClause (a, b, c));
 }
 
 /*------------------------------------------------------------------------*/
@@ -205,6 +168,7 @@ void Internal::ternary_lit (int pivot, int64_t &steps, int64_t &htrs) {
         stats.htrs++;
         for (const auto &lit : *r)
           occs (lit).push_back (r);
+        ternary_add_clause (r);
         if (size == 2) {
           LOG ("hyper ternary resolvent subsumes both antecedents");
           mark_garbage (c);
@@ -284,6 +248,7 @@ bool Internal::ternary_round (int64_t &steps_limit, int64_t &htrs_limit) {
     }
     if (assigned)
       continue;
+    ternary_add_clause (c); // Even if not connected.
     if (c->size == 2) {
 #ifndef QUIET
       bincon++;
@@ -338,6 +303,7 @@ bool Internal::ternary_round (int64_t &steps_limit, int64_t &htrs_limit) {
     PHASE ("ternary", stats.ternary, "completed hyper ternary resolution");
 
   reset_occs ();
+  ternaries.erase ();
   assert (!unsat);
 
   return remain; // Are there variables that should be tried again?
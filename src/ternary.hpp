@@ -0,0 +1,84 @@
+#ifndef _ternary_hpp_INCLUDED
+#define _ternary_hpp_INCLUDED
+
+namespace CaDiCaL {
+
+// Sorted literals of a binary or ternary clause (then 'c' is zero).
+
+struct TernaryClause {
+  int a, b, c;
+  TernaryClause () : a (0), b (0), c (0) {}
+  TernaryClause (int x, int y, int z = 0) {
+    if (x > y)
+      swap (x, y);
+    if (z) {
+      if (y > z)
+        swap (y, z);
+      if (x > y)
+        swap (x, y);
+    }
+    a = x, b = y, c = z;
+  }
+  bool operator== (const TernaryClause &other) const {
+    return a == other.a && b == other.b && c == other.c;
+  }
+  uint64_t hash () const {
+    uint64_t res = (unsigned) a;
+    res = res * 0x9e3779b97f4a7c15ull + (unsigned) b;
+    res = res * 0x9e3779b97f4a7c15ull + (unsigned) c;
+    return res ^ (res >> 32);
+  }
+};
+
+// Hash set of the existing binary and ternary clauses during hyper ternary
+// resolution with open addressing and linear probing.  Empty slots have a
+// zero first literal.  The table is kept at most half full.
+
+struct TernaryClauses {
+
+  vector<TernaryClause> table;
+  size_t count;
+
+  TernaryClauses () : count (0) {}
+
+  size_t find (const TernaryClause &t) const {
+    assert (!table.empty ());
+    const size_t mask = table.size () - 1;
+    size_t pos = t.hash () & mask;
+    while (table[pos].a && !(table[pos] == t))
+      pos = (pos + 1) & mask;
+    return pos;
+  }
+
+  bool contains (const TernaryClause &t) const {
+    return count && table[find (t)].a;
+  }
+
+  void enlarge () {
+    vector<TernaryClause> old;
+    old.swap (table);
+    table.resize (old.empty () ? 1024 : 2 * old.size ());
+    for (const auto &t : old)
+      if (t.a)
+        table[find (t)] = t;
+  }
+
+  void insert (const TernaryClause &t) {
+    if (2 * (count + 1) > table.size ())
+      enlarge ();
+    const size_t pos = find (t);
+    if (table[pos].a)
+      return;
+    table[pos] = t;
+    count++;
+  }
+
+  void erase () {
+    vector<TernaryClause> ().swap (table);
+    count = 0;
+  }
+};
+
+} // namespace CaDiCaL
+
+#endif
@@ -8,34 +8,14 @@ namespace CaDiCaL {
 // binary clauses and is usually pretty fast.  It will also find some failed
 // literals (in the binary implication graph).
 
-void Internal::transred () {
+/*------------------------------------------------------------------------*/
 
-  if (unsat)
-    return;
-  if (terminated_asynchronously ())
-    return;
-  if (!stats.current.redundant && !stats.current.irredundant)
-    return;
+// Check binary clauses one after the other by searching for another path
+// in the binary implication graph.  Clauses checked are flagged, such that
+// the next call continues with the first unchecked clause.
 
-  assert (opts.transred);
-  assert (!level);
-
-  START_SIMPLIFIER (transred, TRANSRED);
-  stats.transreds++;
-
-  // Transitive reduction can not be run to completion for larger formulas
-  // with many binary clauses.  We bound it in the same way as 'probe_core'.
-  //
-  int64_t limit = stats.propagations.search;
-  limit -= last.transred.propagations;
-  limit *= 1e-3 * opts.transredreleff;
-  if (limit < opts.transredmineff)
-    limit = opts.transredmineff;
-  if (limit > opts.transredmaxeff)
-    limit = opts.transredmaxeff;
-
-  PHASE ("transred", stats.transreds,
-         "transitive reduction limit of %" PRId64 " propagations", limit);
+void Internal::transred_bfs (int64_t limit, int64_t &propagations,
+                             int64_t &units, int64_t &removed) {
 
   const auto end = clauses.end ();
   auto i = clauses.begin ();
@@ -78,8 +58,6 @@ void Internal::transred () {
   //
   vector<int> work;
 
-  int64_t propagations = 0, units = 0, removed = 0;
-
   while (!unsat && i != end && !terminated_asynchronously () &&
          propagations < limit) {
     Clause *c = *i++;
@@ -236,10 +214,294 @@ void Internal::transred () {
     }
     lrat_chain.clear ();
   }
+  erase_vector (work);
+}
+
+/*------------------------------------------------------------------------*/
+
+// For dense binary implication graphs the path search above aborts long
+// before all clauses are checked.  The following alternative engine
+// computes reachability for all literals at once instead.  Strongly
+// connected components (equivalent literals) are determined by Tarjan's
+// algorithm on the irredundant binary clauses, which numbers components
+// in reverse topological order.  Thus an edge from component 'C' to 'D'
+// (different from 'C') implies 'D < C'.  Visiting components in that
+// order, the set of components reachable from 'C' is the union of the
+// sets of its successors, which is a word-wise OR of bit-sets.
+
+// The edges of 'C' are visited in descending order of their targets.  If
+// 'D' is reachable through a successor of 'C' visited before, then the
+// edge to 'D' is transitive and its clause can be removed.  All edges to
+// the same 'D' are checked before any of them is added, which keeps
+// duplicated binary clauses (removed during probing anyhow).  Edges within
+// a component are not touched either (they are removed by 'decompose').
+
+// Full bit-sets require quadratic space in the number of components.  We
+// restrict them to windows of consecutive components, such that all
+// windows together never use more than 'transred_window_words' words, and
+// compute reachability for each window separately.  Components below the
+// window can not reach it and are skipped.  Since each window is
+// independent, the limit is only checked between windows.
+
+// Redundant binary clauses are also checked, but their edges are not
+// added, since irredundant clauses can only be removed if they are implied
+// by the other irredundant clauses.  Failed literals are not determined,
+// since we would need to extract the actual path for proof (LRAT) chains.
+
+static const size_t transred_window_words = 1u << 22;
+
+struct transred_edge {
+  unsigned target;
+  Clause *clause;
+};
+
+struct transred_edge_larger {
+  bool operator() (const transred_edge &a,
+                   const transred_edge &b) const {
+    return a.target > b.target;
+  }
+};
+
+int64_t Internal::transred_bits (int64_t limit, int64_t &propagations) {
+
+  // Literal implication graph in compressed adjacency form.
+  //
+  const unsigned nodes = 2 * vsize;
+  vector<unsigned> start (nodes + 1, 0);
+  vector<Clause *> binaries;
+  for (const auto &c : clauses) {
+    if (c->garbage)
+      continue;
+    if (c->size != 2)
+      continue;
+    if (c->redundant && c->hyper)
+      continue;
+    const int a = c->literals[0], b = c->literals[1];
+    if (val (a) || val (b))
+      continue;
+    start[vlit (-a)]++;
+    start[vlit (-b)]++;
+    binaries.push_back (c);
+  }
+  for (unsigned u = 0, sum = 0; u <= nodes; u++) {
+    const unsigned tmp = start[u];
+    start[u] = sum;
+    sum += tmp;
+  }
+  vector<transred_edge> edges (2 * binaries.size ());
+  {
+    vector<unsigned> pos (start.begin (), start.end () - 1);
+    for (const auto &c : binaries) {
+      const int a = c->literals[0], b = c->literals[1];
+      transred_edge &e = edges[pos[vlit (-a)]++];
+      e.target = vlit (b), e.clause = c;
+      transred_edge &f = edges[pos[vlit (-b)]++];
+      f.target = vlit (a), f.clause = c;
+    }
+  }
+  erase_vector (binaries);
+
+  // Iterative version of Tarjan's algorithm on irredundant edges.
+  //
+  const unsigned invalid = UINT_MAX;
+  vector<unsigned> component (nodes, invalid);
+  vector<unsigned> index (nodes, 0), lowlink (nodes, 0), next (nodes);
+  vector<unsigned> work, scc;
+  unsigned components = 0, stamp = 0;
+
+  for (unsigned root = 0; root < nodes; root++) {
+    if (index[root])
+      continue;
+    if (start[root] == start[root + 1] &&
+        start[root ^ 1] == start[(root ^ 1) + 1])
+      continue;
+    work.push_back (root);
+    while (!work.empty ()) {
+      const unsigned u = work.back ();
+      if (!index[u]) {
+        index[u] = lowlink[u] = ++stamp;
+        next[u] = start[u];
+        scc.push_back (u);
+      }
+      bool descended = false;
+      while (next[u] < start[u + 1]) {
+        const transred_edge &e = edges[next[u]];
+        if (!e.clause->redundant) {
+          const unsigned v = e.target;
+          if (!index[v]) {
+            work.push_back (v);
+            descended = true;
+            break;
+          }
+          if (component[v] == invalid && lowlink[v] < lowlink[u])
+            lowlink[u] = lowlink[v];
+        }
+        next[u]++;
+      }
+      if (descended)
+        continue;
+      work.pop_back ();
+      if (lowlink[u] != index[u])
+        continue;
+      unsigned v;
+      do {
+        v = scc.back ();
+        scc.pop_back ();
+        component[v] = components;
+      } while (v != u);
+      components++;
+    }
+  }
+  erase_vector (work);
+  erase_vector (scc);
+  erase_vector (next);
+  erase_vector (lowlink);
+  erase_vector (index);
+
+  // Collect the edges between different components sorted by component.
+  // Redundant edges against the topological order can not be transitive.
+  //
+  vector<unsigned> first (components + 1, 0);
+  for (unsigned u = 0; u < nodes; u++) {
+    if (component[u] == invalid)
+      continue;
+    for (unsigned k = start[u]; k != start[u + 1]; k++)
+      if (component[edges[k].target] < component[u])
+        first[component[u]]++;
+  }
+  for (unsigned c = 0, sum = 0; c <= components; c++) {
+    const unsigned tmp = first[c];
+    first[c] = sum;
+    sum += tmp;
+  }
+  vector<transred_edge> successors (first[components]);
+  {
+    vector<unsigned> pos (first.begin (), first.end () - 1);
+    for (unsigned u = 0; u < nodes; u++) {
+      const unsigned c = component[u];
+      if (c == invalid)
+        continue;
+      for (unsigned k = start[u]; k != start[u + 1]; k++) {
+        const unsigned d = component[edges[k].target];
+        if (d >= c) {
+          assert (d == c || edges[k].clause->redundant);
+          continue;
+        }
+        transred_edge &e = successors[pos[c]++];
+        e.target = d, e.clause = edges[k].clause;
+      }
+    }
+  }
+  erase_vector (edges);
+  erase_vector (start);
+  erase_vector (component);
+  for (unsigned c = 0; c < components; c++)
+    sort (successors.begin () + first[c],
+          successors.begin () + first[c + 1], transred_edge_larger ());
+
+  if (!components)
+    return 0;
+
+  size_t words = (components + 63) / 64;
+  if (words * components > transred_window_words)
+    words = max ((size_t) 1, transred_window_words / components);
+  const unsigned window = 64 * words;
+  vector<uint64_t> reach (words * components);
+
+  int64_t removed = 0, windows = 0;
+
+  for (unsigned lo = 0; lo < components; lo += window) {
+    if (propagations >= limit)
+      break;
+    if (terminated_asynchronously ())
+      break;
+    windows++;
+    const unsigned hi = min (components, lo + window);
+    for (unsigned c = lo; c < components; c++) {
+      propagations++;
+      uint64_t *row = reach.data () + c * words;
+      for (size_t k = 0; k < words; k++)
+        row[k] = 0;
+      if (c < hi)
+        row[(c - lo) / 64] |= 1ull << ((c - lo) % 64);
+      const auto end = successors.begin () + first[c + 1];
+      auto i = successors.begin () + first[c];
+      while (i != end) {
+        const unsigned target = i->target;
+        if (target < lo)
+          break;
+        const unsigned bit = target - lo;
+        const bool reachable =
+            target < hi && ((row[bit / 64] >> (bit % 64)) & 1);
+        bool irredundant = false;
+        for (; i != end && i->target == target; i++) {
+          Clause *d = i->clause;
+          if (!d->redundant)
+            irredundant = true;
+          if (!reachable || d->garbage)
+            continue;
+          removed++;
+          stats.transitive++;
+          LOG (d, "transitive redundant");
+          mark_garbage (d);
+        }
+        if (!irredundant)
+          continue;
+        const uint64_t *other = reach.data () + target * words;
+        for (size_t k = 0; k < words; k++)
+          row[k] |= other[k];
+      }
+    }
+  }
+
+  PHASE ("transred", stats.transreds,
+         "bit-parallel reachability of %u components in %" PRId64
+         " windows of %u",
+         components, windows, window);
+
+  return removed;
+}
+
+/*------------------------------------------------------------------------*/
+
+void Internal::transred () {
+
+  if (unsat)
+    return;
+  if (terminated_asynchronously ())
+    return;
+  if (!stats.current.redundant && !stats.current.irredundant)
+    return;
+
+  assert (opts.transred);
+  assert (!level);
+
+  START_SIMPLIFIER (transred, TRANSRED);
+  stats.transreds++;
+
+  // Transitive reduction can not be run to completion for larger formulas
+  // with many binary clauses.  We bound it in the same way as 'probe_core'.
+  //
+  int64_t limit = stats.propagations.search;
+  limit -= last.transred.propagations;
+  limit *= 1e-3 * opts.transredreleff;
+  if (limit < opts.transredmineff)
+    limit = opts.transredmineff;
+  if (limit > opts.transredmaxeff)
+    limit = opts.transredmaxeff;
+
+  PHASE ("transred", stats.transreds,
+         "transitive reduction limit of %" PRId64 " propagations", limit);
+
+  int64_t propagations = 0, units = 0, removed = 0;
+
+  if (opts.transredbits)
+    removed = transred_bits (limit, propagations);
+  else
+    transred_bfs (limit, propagations, units, removed);
 
   last.transred.propagations = stats.propagations.search;
   stats.propagations.transred += propagations;
-  erase_vector (work);
 
   PHASE ("transred", stats.transreds,
          "removed %" PRId64 " transitive clauses, found %" PRId64 " units",
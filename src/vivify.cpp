@@ -39,6 +39,16 @@ namespace CaDiCaL {
 // with more occurrences first.  Then we sort clauses lexicographically with
 // respect to that literal order.
 
+// Vivifying candidates concurrently against a frozen snapshot of the watch
+// lists does not fit this implementation.  Propagation moves watches and
+// reorders literals in clauses, conflict analysis uses the global variable
+// flags and the trail, and strengthened clauses and units found for one
+// candidate immediately help to vivify the next.  Each worker would thus
+// need its own copy of all watches and clauses, which for large formulas
+// costs more than the propagations saved.  Reusing decisions of the
+// previous candidate gives us a cheap sequential substitute for the
+// separate trails of such workers instead.
+
 /*------------------------------------------------------------------------*/
 
 // For vivification we have a separate dedicated propagation routine, which
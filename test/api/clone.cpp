@@ -0,0 +1,71 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+using namespace std;
+
+static unsigned state = 42;
+
+static unsigned pick (unsigned n) {
+  state = state * 1664525u + 1013904223u;
+  return (state >> 8) % n;
+}
+
+static void add_random_clauses (CaDiCaL::Solver &solver, int vars,
+                                int clauses) {
+  for (int i = 0; i < clauses; i++) {
+    for (int j = 0; j < 3; j++) {
+      int lit = 1 + pick (vars);
+      solver.add (pick (2) ? lit : -lit);
+    }
+    solver.add (0);
+  }
+}
+
+// Apply the same operations to original and clone, which should then
+// behave exactly the same.
+
+static void check_same (CaDiCaL::Solver &a, CaDiCaL::Solver &b, int vars,
+                        int round) {
+  const unsigned saved = state;
+  add_random_clauses (a, vars, 5);
+  state = saved;
+  add_random_clauses (b, vars, 5);
+  const int assumption = 1 + pick (vars);
+  a.assume (assumption);
+  b.assume (assumption);
+  const int res = a.solve ();
+  cout << "round " << round << " solve () = " << res << endl << flush;
+  assert (res == b.solve ());
+  assert (a.redundant () == b.redundant ());
+  assert (a.irredundant () == b.irredundant ());
+  assert (a.active () == b.active ());
+  if (res == 10)
+    for (int idx = 1; idx <= vars; idx++)
+      assert (a.val (idx) == b.val (idx));
+  else
+    assert (a.failed (assumption) == b.failed (assumption));
+}
+
+int main () {
+  const int vars = 150;
+  CaDiCaL::Solver solver;
+  solver.set ("seed", 1);
+  add_random_clauses (solver, vars, 560);
+  for (int round = 0; round < 20; round++) {
+    CaDiCaL::Solver *clone = new CaDiCaL::Solver ();
+    solver.clone (*clone);
+    check_same (solver, *clone, vars, round);
+    if (round & 1) {
+      CaDiCaL::Solver *other = new CaDiCaL::Solver ();
+      clone->clone (*other);
+      delete clone;
+      clone = other;
+    }
+    check_same (solver, *clone, vars, round);
+    delete clone;
+  }
+  return 0;
+}
@@ -0,0 +1,93 @@
+#include "../../src/cadical.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+using namespace std;
+
+// Incrementally add batches of clauses over fresh external variables and
+// retire many of the previous variables through units (and elimination),
+// such that with small 'recyclemin' and 'recycleint' retired internal
+// variables are recycled and reused for the fresh external variables.
+
+static unsigned state = 42;
+
+static unsigned pick (unsigned n) {
+  state = state * 1664525u + 1013904223u;
+  return (state >> 8) % n;
+}
+
+static vector<vector<int>> clauses;
+static vector<signed char> planted;
+
+// Clauses are all satisfied by a planted solution thus every solver call
+// has to return satisfiable.
+
+static void add_clause (CaDiCaL::Solver &solver, const vector<int> &c) {
+  for (const auto &lit : c)
+    solver.add (lit);
+  solver.add (0);
+  clauses.push_back (c);
+}
+
+static void add_batch (CaDiCaL::Solver &solver, int first, int vars,
+                       int size) {
+  planted.resize (first + vars);
+  for (int idx = first; idx < first + vars; idx++)
+    planted[idx] = pick (2) ? 1 : -1;
+  for (int i = 0; i < size; i++) {
+    vector<int> c;
+    bool satisfied = false;
+    for (int j = 0; j < 3; j++) {
+      const int idx = first + pick (vars);
+      const int lit = pick (2) ? idx : -idx;
+      if (planted[idx] * lit > 0)
+        satisfied = true;
+      c.push_back (lit);
+    }
+    if (!satisfied)
+      c[0] = -c[0];
+    add_clause (solver, c);
+  }
+}
+
+// Retire all variables of the batch by fixing them to their model value.
+
+static void fix_batch (CaDiCaL::Solver &solver, int first, int vars) {
+  vector<int> units;
+  for (int idx = first; idx < first + vars; idx++)
+    units.push_back (solver.val (idx));
+  for (const auto &unit : units)
+    add_clause (solver, {unit});
+}
+
+static void check_model (CaDiCaL::Solver &solver) {
+  for (const auto &c : clauses) {
+    bool satisfied = false;
+    for (const auto &lit : c)
+      if (solver.val (abs (lit)) == lit)
+        satisfied = true;
+    assert (satisfied);
+  }
+}
+
+int main () {
+  const int vars = 150, size = 630, rounds = 30;
+  CaDiCaL::Solver solver;
+  solver.set ("recycle", 1);
+  solver.set ("recyclemin", 1);
+  solver.set ("recycleint", 1);
+  planted.push_back (0);
+  for (int round = 0; round < rounds; round++) {
+    add_batch (solver, 1 + round * vars, vars, size);
+    const int res = solver.solve ();
+    cout << "round " << round << " solve () = " << res << endl << flush;
+    assert (res == 10);
+    check_model (solver);
+    fix_batch (solver, 1 + round * vars, vars);
+  }
+  return 0;
+}
@@ -0,0 +1,40 @@
+#include "../../src/cadical.hpp"
+#include <iostream>
+#ifdef NDEBUG
+#undef NDEBUG
+#endif
+#include <cassert>
+using namespace std;
+int main () {
+  CaDiCaL::Solver solver;
+  solver.release_memory ();
+  const int n = 200;
+  for (int round = 0; round < 10; round++) {
+    const int base = round * (n + 1), act = base + n + 1;
+    for (int i = 1; i < n; i++) {
+      solver.add (-act), solver.add (-(base + i)), solver.add (base + i + 1);
+      solver.add (0);
+    }
+    solver.add (-act), solver.add (base + 1), solver.add (0);
+    if (round & 1) {
+      solver.add (-act), solver.add (-(base + n));
+      solver.release_memory (); // in the middle of adding a clause
+      solver.add (0);
+    }
+    solver.assume (act);
+    int res = solver.simplify (1);
+    assert (!res);
+    solver.release_memory ();
+    solver.assume (act);
+    res = solver.solve ();
+    cout << "round " << round << " solve () = " << res << endl << flush;
+    assert (res == ((round & 1) ? 20 : 10));
+    solver.release_memory ();
+    if (res == 10)
+      for (int i = 1; i <= n; i++)
+        assert (solver.val (base + i) > 0);
+    solver.add (-act), solver.add (0);
+  }
+  solver.release_memory ();
+  return 0;
+}
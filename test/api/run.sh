@@ -113,6 +113,9 @@ run cfreeze
 run traverse
 run cipasir
 run incproof
+run release
+run clone
+run recycle
 
 if [ "`grep DNTRACING $makefile`" = "" ]
 then